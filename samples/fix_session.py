@@ -37,7 +37,6 @@ class Client(asyncio.Protocol):
             target_comp_id=target_comp_id,
         )
         self.decoder = roq.codec.fix.Decoder()
-        self.decode_buffer = bytearray()
         self.username = username
         self.password = password
 
@@ -49,15 +48,8 @@ class Client(asyncio.Protocol):
             "[RECV] data=%s",
             data.decode().replace(chr(1), "|"),
         )
-        self.decode_buffer += data
-        while True:
-            length = self.decoder.dispatch(self._callback, bytes(self.decode_buffer))
-            if length == 0:  # need more data
-                break
-            if length > 0:  # a message was decoded
-                self.decode_buffer = self.decode_buffer[length:]
-            if len(self.decode_buffer) == 0:  # no more data
-                break
+        # note! partial messages are retained by the decoder
+        self.decoder.feed(self._callback, data)
 
     def connection_lost(self, exc):
         pass
@@ -0,0 +1,156 @@
+#!/usr/bin/env python
+
+"""
+Copyright (c) 2017-2024, Hans Erik Thrane
+
+Demonstrates the native FIX session (logon, heartbeats, test requests and sequencing are managed by the library)
+
+A local acceptor is started on the loopback interface and the initiator connects to it
+
+With --raise_once, the acceptor's callback raises on the first application message
+The session rolls back the sequence number and the message is dispatched again by the following feed
+"""
+
+import asyncio
+import logging
+
+from datetime import timedelta
+
+import roq
+
+
+class Connection(asyncio.Protocol):
+    """
+    Bridge between an asyncio transport and a FIX session.
+    """
+
+    def __init__(self, sender_comp_id, target_comp_id, initiator, raise_once=False):
+        self.transport = None
+        self.initiator = initiator
+        self.raise_once = raise_once
+        self.session = roq.codec.fix.Session(
+            send=self._send,
+            sender_comp_id=sender_comp_id,
+            target_comp_id=target_comp_id,
+            username="trader",
+            heart_bt_int=timedelta(seconds=5),
+        )
+        self.timer = None
+
+    def connection_made(self, transport):
+        self.transport = transport
+        self.timer = asyncio.get_running_loop().create_task(self._timer())
+        if self.initiator:
+            self.session.logon()
+
+    def data_received(self, data):
+        # note! session messages are consumed, only application messages are dispatched
+        try:
+            self.session.feed(self._callback, data)
+        except RuntimeError as err:
+            logging.warning("[FEED] error=%s, msg_seq_num=%d", err, self.session.msg_seq_num)
+            # note! the failed message has been retained, an empty feed dispatches it again
+            self.session.feed(self._callback, b"")
+
+    def connection_lost(self, exc):
+        if self.timer:
+            self.timer.cancel()
+
+    def _send(self, message):
+        logging.debug(
+            "[SEND] data=%s",
+            message.decode().replace(chr(1), "|"),
+        )
+        self.transport.write(message)
+
+    async def _timer(self):
+        while True:
+            await asyncio.sleep(1)
+            if not self.session.timer():
+                logging.warning("Timeout")
+                self.transport.close()
+                return
+            if self.initiator and self.session.state == roq.codec.fix.SessionState.READY:
+                self._request()
+
+    def _request(self):
+        security_list_request = roq.codec.fix.SecurityListRequest(
+            security_req_id="security_req_id_1",
+            security_list_request_type=roq.fix.SecurityListRequestType.ALL_SECURITIES,
+            subscription_request_type=roq.fix.SubscriptionRequestType.SNAPSHOT,
+        )
+        self.session.send(security_list_request)
+
+    def _callback(self, header, message):
+        if self.raise_once:
+            self.raise_once = False
+            raise RuntimeError("raised once")
+        logging.info(
+            "[EVENT] initiator=%s, message=%s, header=%s",
+            self.initiator,
+            message,
+            header,
+        )
+
+
+async def main(port, raise_once):
+    loop = asyncio.get_running_loop()
+
+    server = await loop.create_server(
+        lambda: Connection(
+            sender_comp_id="acceptor",
+            target_comp_id="initiator",
+            initiator=False,
+            raise_once=raise_once,
+        ),
+        "127.0.0.1",
+        port,
+    )
+
+    await loop.create_connection(
+        lambda: Connection(sender_comp_id="initiator", target_comp_id="acceptor", initiator=True),
+        "127.0.0.1",
+        port,
+    )
+
+    async with server:
+        await server.serve_forever()
+
+
+if __name__ == "__main__":
+    import argparse
+
+    parser = argparse.ArgumentParser(
+        prog="FIX Session (NATIVE)",
+        description="Demonstrates the native FIX session using a loopback acceptor",
+    )
+
+    parser.add_argument(
+        "--loglevel",
+        type=str,
+        required=False,
+        default="info",
+        help="logging level",
+    )
+
+    parser.add_argument(
+        "--port",
+        type=int,
+        required=False,
+        default=1234,
+        help="loopback port",
+    )
+
+    parser.add_argument(
+        "--raise_once",
+        action="store_true",
+        help="the acceptor's callback raises on the first application message",
+    )
+
+    args = parser.parse_args()
+
+    logging.basicConfig(level=args.loglevel.upper())
+
+    del args.loglevel
+
+    asyncio.run(main(**vars(args)))
@@ -0,0 +1,131 @@
+#!/usr/bin/env python
+
+"""
+Copyright (c) 2017-2024, Hans Erik Thrane
+
+Demonstrates the native SBE feed handler (same pipeline as sbe_receiver.py, but without crossing into Python per packet)
+
+Local testing (loopback multicast) is possible using --local_interface=127.0.0.1
+"""
+
+import asyncio
+import logging
+
+from datetime import timedelta
+
+import roq
+
+
+def main(
+    local_interface: str,
+    multicast_snapshot_address: str,
+    multicast_snapshot_port: int,
+    multicast_incremental_address: str,
+    multicast_incremental_port: int,
+    depth: int,
+):
+    """
+    Main function.
+    """
+
+    feed_handler = roq.codec.sbe.FeedHandler(
+        local_interface=local_interface,
+        snapshot_port=multicast_snapshot_port,
+        incremental_port=multicast_incremental_port,
+        snapshot_address=multicast_snapshot_address or "",
+        incremental_address=multicast_incremental_address or "",
+        timeout=timedelta(seconds=1),
+    )
+
+    def update(exchange, symbol, layers):
+        logging.info(
+            "DEPTH: exchange=%s, symbol=%s, depth=%s",
+            exchange,
+            symbol,
+            layers,
+        )
+
+    def reset(exchange, symbol):
+        logging.warning(
+            "RESET: exchange=%s, symbol=%s",
+            exchange,
+            symbol,
+        )
+
+    def poll():
+        feed_handler.poll(update, depth=depth, reset=reset)
+
+    loop = asyncio.new_event_loop()
+
+    asyncio.set_event_loop(loop)
+
+    # note! the sockets are non-blocking and drained when readable
+    loop.add_reader(feed_handler.snapshot_fd, poll)
+    loop.add_reader(feed_handler.incremental_fd, poll)
+
+    loop.run_forever()
+
+    loop.close()
+
+
+if __name__ == "__main__":
+    import argparse
+
+    parser = argparse.ArgumentParser(
+        prog="SBE Feed Handler (NATIVE)",
+        description="Demonstrates the native SBE feed handler",
+    )
+
+    parser.add_argument(
+        "--loglevel",
+        type=str,
+        required=False,
+        default="info",
+        help="logging level",
+    )
+
+    parser.add_argument(
+        "--local_interface",
+        type=str,
+        required=True,
+        help="ipv4 address of a network interface",
+    )
+    parser.add_argument(
+        "--multicast_snapshot_address",
+        type=str,
+        required=False,
+        help="ipv4 address of a multicast group",
+    )
+    parser.add_argument(
+        "--multicast_snapshot_port",
+        type=int,
+        required=True,
+        help="multicast port",
+    )
+    parser.add_argument(
+        "--multicast_incremental_address",
+        type=str,
+        required=False,
+        help="ipv4 address of a multicast group",
+    )
+    parser.add_argument(
+        "--multicast_incremental_port",
+        type=int,
+        required=True,
+        help="multicast port",
+    )
+    parser.add_argument(
+        "--depth",
+        type=int,
+        required=False,
+        default=2,
+        help="number of levels",
+    )
+
+    args = parser.parse_args()
+
+    logging.basicConfig(level=args.loglevel.upper())
+
+    del args.loglevel
+
+    main(**vars(args))
@@ -16,9 +16,6 @@ from fastcore.all import typedispatch
 import roq
 
 
-SIZE_OF_UDP_HEADER = roq.codec.udp.Header.sizeof()
-
-
 class Instrument:
     """
     Instrument state.
@@ -149,7 +146,7 @@ class Receiver:
         self.transport = None
         self.reorder_buffer = roq.io.net.ReorderBuffer()
         self.decoder = roq.codec.sbe.Decoder()
-        self.decode_buffer = bytearray()
+        self.reassembler = roq.codec.udp.Reassembler()
         self.shared = shared
         self.header = None
 
@@ -174,32 +171,18 @@ class Receiver:
         Datagrams are ordered by sequence number.
         """
 
-        self.header = roq.codec.udp.Header(data)
-        last = self.header.fragment == self.header.fragment_max
-        payload = data[SIZE_OF_UDP_HEADER:]
-        if last:
-            if len(self.decode_buffer) > 0:
-                self.decode_buffer += payload
-                length = self.decoder.dispatch(self._callback, self.decode_buffer)
-                assert length == len(self.decode_buffer), "internal error"
-                self.decode_buffer = bytearray()
-            elif self.header.fragment == 0:
-                length = self.decoder.dispatch(self._callback, payload)
-                assert length == len(payload), "internal error"
-            else:
-                # NOTE
-                #   After packet loss and we have re-joined in the middle of a fragmented message.
-                pass
-        else:
-            if self.header.fragment == 0:
-                assert len(self.decode_buffer) == 0, "internal error"
-                self.decode_buffer = payload
-            elif len(self.decode_buffer) > 0:
-                self.decode_buffer += payload
-            else:
-                # NOTE
-                #   After packet loss and we have re-joined in the middle of a fragmented message.
-                pass
+        # note! fragments are reassembled natively (no bytes concatenation)
+        self.reassembler.dispatch(data, self._message)
+
+    def _message(self, header, payload):
+        """
+        Callback from the reassembler.
+        Payload is a complete message (only valid during the callback).
+        """
+
+        self.header = header
+        length = self.decoder.dispatch(self._callback, payload)
+        assert length == len(payload), "internal error"
 
     def _reset(self):
         """
@@ -207,6 +190,8 @@ class Receiver:
         Packet loss has been detected if this handler is called.
         """
 
+        self.reassembler.clear()
+
     @typedispatch
     def _callback(
         self,
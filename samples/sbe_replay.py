@@ -0,0 +1,96 @@
+#!/usr/bin/env python
+
+"""
+Copyright (c) 2017-2024, Hans Erik Thrane
+
+Demonstrates replaying a capture file (pcap or pcapng) through the SBE receive pipeline
+
+Without --verbose only the native pipeline is exercised (useful for profiling)
+"""
+
+import logging
+
+import roq
+
+
+def main(
+    path: str,
+    port: list[int],
+    speed: float,
+    verbose: bool,
+):
+    """
+    Main function.
+    """
+
+    def callback(message_info, obj):
+        logging.info("message_info=%s, obj=%s", message_info, obj)
+
+    result = roq.codec.sbe.replay(
+        path,
+        callback=callback if verbose else None,
+        ports=port or [],
+        speed=speed,
+    )
+
+    elapsed = result["elapsed"].total_seconds()
+
+    logging.info(
+        "packets=%d, bytes=%d, skipped=%d, resets=%d, elapsed=%s, rate=%.0f packets/s",
+        result["packets"],
+        result["bytes"],
+        result["skipped"],
+        result["resets"],
+        result["elapsed"],
+        result["packets"] / elapsed if elapsed > 0.0 else 0.0,
+    )
+
+
+if __name__ == "__main__":
+    import argparse
+
+    parser = argparse.ArgumentParser(
+        prog="SBE Replay",
+        description="Demonstrates replaying a capture file through the SBE pipeline",
+    )
+
+    parser.add_argument(
+        "--loglevel",
+        type=str,
+        required=False,
+        default="info",
+        help="logging level",
+    )
+
+    parser.add_argument(
+        "--port",
+        type=int,
+        action="append",
+        required=False,
+        help="destination port (may be repeated, default is all)",
+    )
+    parser.add_argument(
+        "--speed",
+        type=float,
+        required=False,
+        default=0.0,
+        help="replay speed relative to the capture timestamps (0 means as fast as possible)",
+    )
+    parser.add_argument(
+        "--verbose",
+        action="store_true",
+        help="log all decoded messages",
+    )
+    parser.add_argument(
+        "path",
+        type=str,
+        help="capture file",
+    )
+
+    args = parser.parse_args()
+
+    logging.basicConfig(level=args.loglevel.upper())
+
+    del args.loglevel
+
+    main(**vars(args))
@@ -13,6 +13,41 @@ using namespace std::literals;
 namespace roq {
 namespace python {
 
+namespace {
+auto to_dict(std::optional<client::LatencyTracker> const &latency_tracker) {
+  pybind11::dict result;
+  if (latency_tracker)
+    (*latency_tracker).for_each([&](auto &item) {
+      auto key = pybind11::make_tuple(item.source_name, item.event, item.type);
+      result[key] = item.histogram;
+    });
+  return result;
+}
+
+// note! nanoseconds
+auto to_dict(std::optional<client::Profiler> const &profiler) {
+  pybind11::dict result;
+  if (profiler) {
+    auto nanoseconds_per_tick = (*profiler).nanoseconds_per_tick();
+    auto convert = [&](auto value) { return static_cast<uint64_t>(static_cast<double>(value) * nanoseconds_per_tick); };
+    (*profiler).for_each([&](auto &item) {
+      auto &histogram = item.histogram;
+      pybind11::dict stats;
+      stats["count"] = histogram.count();
+      stats["mean"] = histogram.mean() * nanoseconds_per_tick;
+      stats["min"] = convert(histogram.min());
+      stats["max"] = convert(histogram.max());
+      stats["p50"] = convert(histogram.percentile(50.0));
+      stats["p90"] = convert(histogram.percentile(90.0));
+      stats["p99"] = convert(histogram.percentile(99.0));
+      stats["p999"] = convert(histogram.percentile(99.9));
+      result[pybind11::str(item.event)] = stats;
+    });
+  }
+  return result;
+}
+}  // namespace
+
 template <>
 void utils::create_struct<client::Settings2>(pybind11::module_ &module) {
   using value_type = client::Settings2;
@@ -61,16 +96,36 @@ void utils::create_struct<client::Dispatcher>(pybind11::module_ &module) {
           pybind11::init<
               python::client::Settings2 const &,
               python::client::Config const &,
-              std::vector<std::string> const &>(),
+              std::vector<std::string> const &,
+              bool,
+              bool,
+              bool>(),
           pybind11::arg("settings"),
           pybind11::arg("config"),
-          pybind11::arg("connections"))
+          pybind11::arg("connections"),
+          pybind11::arg("send_queue") = false,
+          pybind11::arg("track_latency") = false,
+          pybind11::arg("profile") = false)
       .def("start", [](value_type &self) { return self.start(); })
       .def("stop", [](value_type &self) { return self.stop(); })
       .def(
           "dispatch",
           [](value_type &self, pybind11::object handler) { return self.dispatch(handler); },
           pybind11::arg("handler"))
+      .def_property_readonly("send_queue_size", [](value_type const &self) { return self.send_queue_size(); })
+      .def(
+          "clear_send_queue",
+          [](value_type &self, std::optional<uint8_t> const &source) { return self.clear_send_queue(source); },
+          pybind11::arg("source") = pybind11::none(),
+          "Drop queued requests (all or by source), returns the number of requests dropped")
+      .def(
+          "latency",
+          [](value_type const &self) { return to_dict(self.latency_tracker()); },
+          "Latency histograms (nanoseconds) keyed by (source_name, event, latency_type)")
+      .def(
+          "stats",
+          [](value_type const &self) { return to_dict(self.profiler()); },
+          "Callback profiling (nanoseconds) keyed by event")
       .def(
           "create_order",
           [](value_type &self,
@@ -213,14 +268,26 @@ void utils::create_struct<client::EventLogReader>(pybind11::module_ &module) {
   using value_type = client::EventLogReader;
   std::string name{nameof::nameof_short_type<value_type>()};
   pybind11::class_<value_type>(module, name.c_str())
-      .def(pybind11::init<std::string_view const &>(), pybind11::arg("path"))
+      .def(
+          pybind11::init<std::string_view const &, bool, bool>(),
+          pybind11::arg("path"),
+          pybind11::arg("track_latency") = false,
+          pybind11::arg("profile") = false)
       // note! the callback signature **MUST** be pybind11::object so we can verify the reference count hasn't increased
       .def(
           "dispatch",
           [](value_type &self, std::function<void(pybind11::object, pybind11::object)> &callback) {
             return self.dispatch(callback);
           },
-          pybind11::arg("callback"));
+          pybind11::arg("callback"))
+      .def(
+          "latency",
+          [](value_type const &self) { return to_dict(self.latency_tracker()); },
+          "Latency histograms (nanoseconds) keyed by (source_name, event, latency_type)")
+      .def(
+          "stats",
+          [](value_type const &self) { return to_dict(self.profiler()); },
+          "Callback profiling (nanoseconds) keyed by event");
 }
 
 template <>
@@ -228,14 +295,26 @@ void utils::create_struct<client::EventLogMultiplexer>(pybind11::module_ &module
   using value_type = client::EventLogMultiplexer;
   std::string name{nameof::nameof_short_type<value_type>()};
   pybind11::class_<value_type>(module, name.c_str())
-      .def(pybind11::init<std::vector<std::string_view> const &>(), pybind11::arg("paths"))
+      .def(
+          pybind11::init<std::vector<std::string_view> const &, bool, bool>(),
+          pybind11::arg("paths"),
+          pybind11::arg("track_latency") = false,
+          pybind11::arg("profile") = false)
       // note! the callback signature **MUST** be pybind11::object so we can verify the reference count hasn't increased
       .def(
           "dispatch",
           [](value_type &self, std::function<void(pybind11::object, pybind11::object)> &callback) {
             return self.dispatch(callback);
           },
-          pybind11::arg("callback"));
+          pybind11::arg("callback"))
+      .def(
+          "latency",
+          [](value_type const &self) { return to_dict(self.latency_tracker()); },
+          "Latency histograms (nanoseconds) keyed by (source_name, event, latency_type)")
+      .def(
+          "stats",
+          [](value_type const &self) { return to_dict(self.profiler()); },
+          "Callback profiling (nanoseconds) keyed by event");
 }
 
 }  // namespace python
@@ -2,7 +2,9 @@
 
 #include <pybind11/pybind11.h>
 
+#include <chrono>
 #include <map>
+#include <optional>
 #include <set>
 
 // #include <absl/flags/parse.h>  // XXX shouldn't be here...
@@ -17,6 +19,10 @@
 
 #include "roq/python/utils.hpp"
 
+#include "roq/python/client/latency_tracker.hpp"
+#include "roq/python/client/profiler.hpp"
+#include "roq/python/client/send_queue.hpp"
+
 namespace roq {
 namespace python {
 namespace client {
@@ -76,14 +82,18 @@ struct PyHandler : public Handler {
 
 namespace {
 struct Bridge final : public roq::client::Handler {
-  explicit Bridge(roq::client::Dispatcher &, python::client::Handler &handler) : handler_{handler} {}
+  Bridge(roq::client::Dispatcher &, python::client::Handler &handler, std::optional<Profiler> &profiler)
+      : handler_{handler}, profiler_{profiler} {}
 
  protected:
   template <typename T>
   void dispatch(auto const &message_info, T const &value) {
     auto arg0 = pybind11::cast(utils::Ref<MessageInfo>{message_info});
     auto arg1 = pybind11::cast(utils::Ref<T>{value});
-    handler_.callback(arg0, arg1);
+    if (profiler_)
+      (*profiler_)(value, [&]() { handler_.callback(arg0, arg1); });
+    else
+      handler_.callback(arg0, arg1);
     if (arg0.ref_count() > 1 || arg1.ref_count() > 1) {
       using namespace std::literals;
       throw std::runtime_error{"Objects must not be stored"s};
@@ -141,17 +151,28 @@ struct Bridge final : public roq::client::Handler {
 
  private:
   python::client::Handler &handler_;
+  std::optional<Profiler> &profiler_;
 };
 
 struct Bridge2 final : public roq::client::Simple::Handler {
-  explicit Bridge2(python::client::Handler &handler) : handler_{handler} {}
+  Bridge2(
+      python::client::Handler &handler,
+      std::optional<SendQueue> &send_queue,
+      std::optional<LatencyTracker> &latency_tracker,
+      std::optional<Profiler> &profiler)
+      : handler_{handler}, send_queue_{send_queue}, latency_tracker_{latency_tracker}, profiler_{profiler} {}
 
  protected:
   template <typename T>
   void dispatch(auto const &message_info, T const &value) {
     auto arg0 = pybind11::cast(utils::Ref<MessageInfo>{message_info});
     auto arg1 = pybind11::cast(utils::Ref<T>{value});
-    handler_.callback(arg0, arg1);
+    if (latency_tracker_)
+      (*latency_tracker_)(message_info, value);
+    if (profiler_)
+      (*profiler_)(value, [&]() { handler_.callback(arg0, arg1); });
+    else
+      handler_.callback(arg0, arg1);
     if (arg0.ref_count() > 1 || arg1.ref_count() > 1) {
       using namespace std::literals;
       throw std::runtime_error{"Objects must not be stored"s};
@@ -162,7 +183,17 @@ struct Bridge2 final : public roq::client::Simple::Handler {
   void operator()(Event<roq::Start> const &event) override { dispatch(event.message_info, event.value); }
   void operator()(Event<roq::Stop> const &event) override { dispatch(event.message_info, event.value); }
   void operator()(Event<roq::Connected> const &event) override { dispatch(event.message_info, event.value); }
-  void operator()(Event<roq::Disconnected> const &event) override { dispatch(event.message_info, event.value); }
+  // note! queued requests were meant for the previous order state of the gateway
+  void operator()(Event<roq::Disconnected> const &event) override {
+    if (send_queue_) {
+      auto count = (*send_queue_).clear(event.message_info.source);
+      if (count) {
+        using namespace std::literals;
+        log::warn("Dropped {} queued request(s) for source={}"sv, count, event.message_info.source);
+      }
+    }
+    dispatch(event.message_info, event.value);
+  }
 
   void operator()(Event<roq::DownloadBegin> const &event) override { dispatch(event.message_info, event.value); }
   void operator()(Event<roq::DownloadEnd> const &event) override { dispatch(event.message_info, event.value); }
@@ -171,8 +202,16 @@ struct Bridge2 final : public roq::client::Simple::Handler {
 
   void operator()(Event<roq::StreamStatus> const &event) override { dispatch(event.message_info, event.value); }
   void operator()(Event<roq::ExternalLatency> const &event) override { dispatch(event.message_info, event.value); }
-  void operator()(Event<roq::RateLimitsUpdate> const &event) override { dispatch(event.message_info, event.value); }
-  void operator()(Event<roq::RateLimitTrigger> const &event) override { dispatch(event.message_info, event.value); }
+  void operator()(Event<roq::RateLimitsUpdate> const &event) override {
+    if (send_queue_)
+      (*send_queue_)(event.value, event.message_info.source);
+    dispatch(event.message_info, event.value);
+  }
+  void operator()(Event<roq::RateLimitTrigger> const &event) override {
+    if (send_queue_)
+      (*send_queue_)(event.value, event.message_info.source);
+    dispatch(event.message_info, event.value);
+  }
 
   void operator()(Event<roq::GatewayStatus> const &event) override { dispatch(event.message_info, event.value); }
 
@@ -208,6 +247,9 @@ struct Bridge2 final : public roq::client::Simple::Handler {
 
  private:
   python::client::Handler &handler_;
+  std::optional<SendQueue> &send_queue_;
+  std::optional<LatencyTracker> &latency_tracker_;
+  std::optional<Profiler> &profiler_;
 };
 }  // namespace
 
@@ -215,10 +257,16 @@ struct Dispatcher final {
   Dispatcher(
       python::client::Settings2 const &settings,
       python::client::Config const &config,
-      std::vector<std::string> const &connections)
+      std::vector<std::string> const &connections,
+      bool send_queue,
+      bool track_latency,
+      bool profile)
       : settings_{create_settings(settings)}, config_{config}, connections_{connections},
         context_{roq::io::engine::ContextFactory::create("libevent")},
-        dispatcher_{create_dispatcher(settings_, config, *context_, connections)} {}
+        dispatcher_{create_dispatcher(settings_, config, *context_, connections)},
+        send_queue_{send_queue ? std::make_optional<SendQueue>() : std::nullopt},
+        latency_tracker_{track_latency ? std::make_optional<LatencyTracker>() : std::nullopt},
+        profiler_{profile ? std::make_optional<Profiler>() : std::nullopt} {}
 
  protected:
   static roq::client::Settings2 create_settings(roq::client::Settings2 const &) {
@@ -259,18 +307,48 @@ struct Dispatcher final {
 
   bool dispatch(pybind11::object handler) {
     try {
-      Bridge2 bridge{pybind11::cast<python::client::Handler &>(handler)};
-      return (*dispatcher_).dispatch(bridge);
+      Bridge2 bridge{pybind11::cast<python::client::Handler &>(handler), send_queue_, latency_tracker_, profiler_};
+      auto result = (*dispatcher_).dispatch(bridge);
+      if (send_queue_ && !(*send_queue_).empty())
+        (*send_queue_).drain(now(), [this](auto const &value, uint8_t source) { (*dispatcher_).send(value, source); });
+      return result;
     } catch (pybind11::error_already_set &) {
       throw;
     }
     return false;
   }
-  void send(roq::CreateOrder const &create_order, uint8_t source) { (*dispatcher_).send(create_order, source); }
-  void send(roq::ModifyOrder const &modify_order, uint8_t source) { (*dispatcher_).send(modify_order, source); }
-  void send(roq::CancelOrder const &cancel_order, uint8_t source) { (*dispatcher_).send(cancel_order, source); }
-  void send(roq::CancelAllOrders const &cancel_all_orders, uint8_t source) {
-    (*dispatcher_).send(cancel_all_orders, source);
+  void send(roq::CreateOrder const &create_order, uint8_t source) { send_helper(create_order, source); }
+  void send(roq::ModifyOrder const &modify_order, uint8_t source) { send_helper(modify_order, source); }
+  void send(roq::CancelOrder const &cancel_order, uint8_t source) { send_helper(cancel_order, source); }
+  void send(roq::CancelAllOrders const &cancel_all_orders, uint8_t source) { send_helper(cancel_all_orders, source); }
+
+  size_t send_queue_size() const { return send_queue_ ? (*send_queue_).size() : size_t{}; }
+
+  // note! returns the number of requests dropped
+  size_t clear_send_queue(std::optional<uint8_t> const &source) {
+    if (!send_queue_)
+      return {};
+    return source ? (*send_queue_).clear(*source) : (*send_queue_).clear();
+  }
+
+  std::optional<LatencyTracker> const &latency_tracker() const { return latency_tracker_; }
+
+  std::optional<Profiler> const &profiler() const { return profiler_; }
+
+ protected:
+  template <typename T>
+  void send_helper(T const &value, uint8_t source) {
+    if (send_queue_)
+      (*send_queue_)(value, source, now(), [this](auto const &value_2, uint8_t source_2) {
+        (*dispatcher_).send(value_2, source_2);
+      });
+    else
+      (*dispatcher_).send(value, source);
+  }
+
+  static std::chrono::nanoseconds now() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::system_clock::now().time_since_epoch());
   }
 
  private:
@@ -279,19 +357,29 @@ struct Dispatcher final {
   std::vector<std::string> const connections_;
   std::unique_ptr<roq::io::Context> context_;
   std::unique_ptr<roq::client::Simple> dispatcher_;
+  std::optional<SendQueue> send_queue_;
+  std::optional<LatencyTracker> latency_tracker_;
+  std::optional<Profiler> profiler_;
 };
 
 struct EventLogReader final {
   template <typename Callback>
   struct Handler final : public roq::client::EventLogReader::Handler {
-    explicit Handler(Callback const &callback) : callback_{callback} {}
+    Handler(
+        Callback const &callback, std::optional<LatencyTracker> &latency_tracker, std::optional<Profiler> &profiler)
+        : callback_{callback}, latency_tracker_{latency_tracker}, profiler_{profiler} {}
 
    protected:
     template <typename T>
     void dispatch(auto const &message_info, T const &value) {
       auto arg0 = pybind11::cast(utils::Ref<MessageInfo>{message_info});
       auto arg1 = pybind11::cast(utils::Ref<T>{value});
-      callback_(arg0, arg1);
+      if (latency_tracker_)
+        (*latency_tracker_)(message_info, value);
+      if (profiler_)
+        (*profiler_)(value, [&]() { callback_(arg0, arg1); });
+      else
+        callback_(arg0, arg1);
       if (arg0.ref_count() > 1 || arg1.ref_count() > 1) {
         using namespace std::literals;
         throw std::runtime_error{"Objects must not be stored"s};
@@ -353,13 +441,18 @@ struct EventLogReader final {
 
    private:
     Callback const &callback_;
+    std::optional<LatencyTracker> &latency_tracker_;
+    std::optional<Profiler> &profiler_;
   };
-  EventLogReader(std::string_view const &path) : reader_(roq::client::EventLogReaderFactory::create(path)) {}
+  EventLogReader(std::string_view const &path, bool track_latency, bool profile)
+      : reader_(roq::client::EventLogReaderFactory::create(path)),
+        latency_tracker_{track_latency ? std::make_optional<LatencyTracker>() : std::nullopt},
+        profiler_{profile ? std::make_optional<Profiler>() : std::nullopt} {}
 
   template <typename Callback>
   bool dispatch(Callback const &callback) {
     try {
-      Handler handler(callback);
+      Handler handler{callback, latency_tracker_, profiler_};
       for (;;) {
         if (!(*reader_).dispatch(handler))
           break;
@@ -374,21 +467,34 @@ struct EventLogReader final {
     return false;
   }
 
+  std::optional<LatencyTracker> const &latency_tracker() const { return latency_tracker_; }
+
+  std::optional<Profiler> const &profiler() const { return profiler_; }
+
  private:
   std::unique_ptr<roq::client::EventLogReader> reader_;
+  std::optional<LatencyTracker> latency_tracker_;
+  std::optional<Profiler> profiler_;
 };
 
 struct EventLogMultiplexer final {
   template <typename Callback>
   struct Handler final : public roq::client::EventLogMultiplexer::Handler {
-    explicit Handler(Callback const &callback) : callback_{callback} {}
+    Handler(
+        Callback const &callback, std::optional<LatencyTracker> &latency_tracker, std::optional<Profiler> &profiler)
+        : callback_{callback}, latency_tracker_{latency_tracker}, profiler_{profiler} {}
 
    protected:
     template <typename T>
     void dispatch(auto const &message_info, T const &value) {
       auto arg0 = pybind11::cast(utils::Ref<MessageInfo>{message_info});
       auto arg1 = pybind11::cast(utils::Ref<T>{value});
-      callback_(arg0, arg1);
+      if (latency_tracker_)
+        (*latency_tracker_)(message_info, value);
+      if (profiler_)
+        (*profiler_)(value, [&]() { callback_(arg0, arg1); });
+      else
+        callback_(arg0, arg1);
       if (arg0.ref_count() > 1 || arg1.ref_count() > 1) {
         using namespace std::literals;
         throw std::runtime_error{"Objects must not be stored"s};
@@ -455,14 +561,18 @@ struct EventLogMultiplexer final {
 
    private:
     Callback const &callback_;
+    std::optional<LatencyTracker> &latency_tracker_;
+    std::optional<Profiler> &profiler_;
   };
-  EventLogMultiplexer(std::vector<std::string_view> const &paths)
-      : multiplexer_(roq::client::EventLogMultiplexerFactory::create(paths)) {}
+  EventLogMultiplexer(std::vector<std::string_view> const &paths, bool track_latency, bool profile)
+      : multiplexer_(roq::client::EventLogMultiplexerFactory::create(paths)),
+        latency_tracker_{track_latency ? std::make_optional<LatencyTracker>() : std::nullopt},
+        profiler_{profile ? std::make_optional<Profiler>() : std::nullopt} {}
 
   template <typename Callback>
   bool dispatch(Callback const &callback) {
     try {
-      Handler handler(callback);
+      Handler handler{callback, latency_tracker_, profiler_};
       for (;;) {
         if (!(*multiplexer_).dispatch(handler))
           break;
@@ -477,8 +587,14 @@ struct EventLogMultiplexer final {
     return false;
   }
 
+  std::optional<LatencyTracker> const &latency_tracker() const { return latency_tracker_; }
+
+  std::optional<Profiler> const &profiler() const { return profiler_; }
+
  private:
   std::unique_ptr<roq::client::EventLogMultiplexer> multiplexer_;
+  std::optional<LatencyTracker> latency_tracker_;
+  std::optional<Profiler> profiler_;
 };
 
 }  // namespace client
@@ -0,0 +1,97 @@
+/* Copyright (c) 2017-2024, Hans Erik Thrane */
+
+#pragma once
+
+#include <nameof.hpp>
+
+#include <chrono>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include "roq/api.hpp"
+
+#include "roq/python/histogram.hpp"
+
+namespace roq {
+namespace python {
+namespace client {
+
+enum class LatencyType : uint8_t {
+  GATEWAY_TO_CLIENT,    // source_send_time => receive_time
+  EXCHANGE_TO_GATEWAY,  // exchange_time_utc => origin_create_time_utc
+  EXTERNAL,             // ExternalLatency
+};
+
+// note! latency distributions (nanoseconds) by source, event type and latency type
+//   callback duration is measured by the profiler
+
+struct LatencyTracker final {
+  struct Item final {
+    uint8_t source = {};
+    std::string source_name;
+    std::string_view event;
+    LatencyType type = {};
+    Histogram histogram;
+  };
+
+  template <typename T>
+  void operator()(MessageInfo const &message_info, T const &value) {
+    if (message_info.source_send_time.count() && message_info.receive_time.count())
+      get<T>(message_info, LatencyType::GATEWAY_TO_CLIENT)(
+          (message_info.receive_time - message_info.source_send_time).count());
+    if constexpr (requires { value.exchange_time_utc; }) {
+      if (value.exchange_time_utc.count() && message_info.origin_create_time_utc.count())
+        get<T>(message_info, LatencyType::EXCHANGE_TO_GATEWAY)(
+            (message_info.origin_create_time_utc - value.exchange_time_utc).count());
+    }
+    if constexpr (std::is_same<T, roq::ExternalLatency>::value) {
+      get<T>(message_info, LatencyType::EXTERNAL)(value.latency.count());
+    }
+  }
+
+  template <typename Callback>
+  void for_each(Callback &&callback) const {
+    for (auto &[_, item] : items_)
+      callback(item);
+  }
+
+  void clear() { items_.clear(); }
+
+ protected:
+  template <typename T>
+  Histogram &get(MessageInfo const &message_info, LatencyType type) {
+    auto key = (static_cast<uint64_t>(message_info.source) << 32) | (static_cast<uint64_t>(type_index<T>()) << 8) |
+               static_cast<uint64_t>(type);
+    auto iter = items_.find(key);
+    if (iter == std::end(items_)) [[unlikely]] {
+      auto item = Item{
+          .source = message_info.source,
+          .source_name = std::string{message_info.source_name},
+          .event = nameof::nameof_short_type<T>(),
+          .type = type,
+          .histogram = {},
+      };
+      iter = items_.emplace(key, std::move(item)).first;
+    }
+    return (*iter).second.histogram;
+  }
+
+  static size_t next_type_index() {
+    static size_t counter = {};
+    return counter++;
+  }
+
+  template <typename T>
+  static size_t type_index() {
+    static size_t const result = next_type_index();
+    return result;
+  }
+
+ private:
+  std::unordered_map<uint64_t, Item> items_;
+};
+
+}  // namespace client
+}  // namespace python
+}  // namespace roq
@@ -17,6 +17,8 @@ void Module::create(pybind11::module_ &module) {
       .def(pybind11::init<>())
       .def("callback", &roq::python::client::Handler::callback);
 
+  utils::create_enum<roq::python::client::LatencyType>(module);
+
   utils::create_struct<roq::python::client::Settings2>(module);
 
   utils::create_struct<roq::client::Settings>(module);  // XXX
@@ -0,0 +1,108 @@
+/* Copyright (c) 2017-2024, Hans Erik Thrane */
+
+#pragma once
+
+#include <nameof.hpp>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#include <chrono>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+#include "roq/python/histogram.hpp"
+
+namespace roq {
+namespace python {
+namespace client {
+
+// note!
+//   time spent inside the python callback, by event type
+//   samples are recorded as cpu ticks (rdtsc) and only converted to nanoseconds when reported
+//   the tick rate is calibrated against steady_clock over the lifetime of the profiler
+
+struct Profiler final {
+  struct Item final {
+    std::string_view event;
+    Histogram histogram;  // ticks
+  };
+
+  Profiler() : start_ticks_{ticks()}, start_time_{std::chrono::steady_clock::now()} {}
+
+  template <typename T, typename Callback>
+  void operator()(T const &, Callback const &callback) {
+    auto start = ticks();
+    callback();
+    get<T>()(ticks() - start);
+  }
+
+  template <typename Callback>
+  void for_each(Callback &&callback) const {
+    for (auto &item : items_)
+      if (item.histogram.count())
+        callback(item);
+  }
+
+  void clear() {
+    for (auto &item : items_)
+      item.histogram.clear();
+  }
+
+  // note! ticks => nanoseconds
+  double nanoseconds_per_tick() const {
+#if defined(__x86_64__) || defined(__i386__)
+    auto elapsed_ticks = ticks() - start_ticks_;
+    auto elapsed_time =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start_time_);
+    if (!elapsed_ticks)
+      return 1.0;
+    return static_cast<double>(elapsed_time.count()) / static_cast<double>(elapsed_ticks);
+#else
+    return 1.0;
+#endif
+  }
+
+ protected:
+  static uint64_t ticks() {
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+#endif
+  }
+
+  template <typename T>
+  Histogram &get() {
+    auto index = type_index<T>();
+    if (index >= std::size(items_)) [[unlikely]]
+      items_.resize(index + 1);
+    auto &item = items_[index];
+    if (std::empty(item.event)) [[unlikely]]
+      item.event = nameof::nameof_short_type<T>();
+    return item.histogram;
+  }
+
+  static size_t next_type_index() {
+    static size_t counter = {};
+    return counter++;
+  }
+
+  template <typename T>
+  static size_t type_index() {
+    static size_t const result = next_type_index();
+    return result;
+  }
+
+ private:
+  uint64_t const start_ticks_;
+  std::chrono::steady_clock::time_point const start_time_;
+  std::vector<Item> items_;
+};
+
+}  // namespace client
+}  // namespace python
+}  // namespace roq
@@ -0,0 +1,410 @@
+/* Copyright (c) 2017-2024, Hans Erik Thrane */
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <deque>
+#include <map>
+#include <string>
+#include <string_view>
+#include <variant>
+#include <vector>
+
+#include "roq/api.hpp"
+
+namespace roq {
+namespace python {
+namespace client {
+
+// note!
+//   order actions are released immediately when the advertised rate limits allow it
+//   otherwise they're queued and released by drain
+//   there is one queue per (source, account), i.e. a throttled account never blocks other accounts
+//   requests for the same (source, account) are released in order
+//   a queued modify is superseded by any following modify (or cancel) for the same order
+//     the replacement inherits conditional_on_version (the gateway never saw the superseded version)
+//   limits are tracked per (source, account) and merged by (type, period), i.e. updates of one type don't
+//   replace the others
+//   a request failing to send (exception) is removed from the queue and doesn't consume the rate limit
+
+struct SendQueue final {
+  struct CreateOrder final {
+    using value_type = roq::CreateOrder;
+
+    explicit CreateOrder(value_type const &value)
+        : account{value.account}, order_id{value.order_id}, exchange{value.exchange}, symbol{value.symbol},
+          side{value.side}, position_effect{value.position_effect}, margin_mode{value.margin_mode},
+          max_show_quantity{value.max_show_quantity}, order_type{value.order_type},
+          time_in_force{value.time_in_force}, execution_instructions{value.execution_instructions},
+          request_template{value.request_template}, quantity{value.quantity}, price{value.price},
+          stop_price{value.stop_price}, routing_id{value.routing_id}, strategy_id{value.strategy_id} {}
+
+    operator value_type() const {
+      return {
+          .account = account,
+          .order_id = order_id,
+          .exchange = exchange,
+          .symbol = symbol,
+          .side = side,
+          .position_effect = position_effect,
+          .margin_mode = margin_mode,
+          .max_show_quantity = max_show_quantity,
+          .order_type = order_type,
+          .time_in_force = time_in_force,
+          .execution_instructions = execution_instructions,
+          .request_template = request_template,
+          .quantity = quantity,
+          .price = price,
+          .stop_price = stop_price,
+          .routing_id = routing_id,
+          .strategy_id = strategy_id,
+      };
+    }
+
+    std::string account;
+    uint32_t order_id = {};
+    std::string exchange;
+    std::string symbol;
+    roq::Side side = {};
+    roq::PositionEffect position_effect = {};
+    roq::MarginMode margin_mode = {};
+    double max_show_quantity = NaN;
+    roq::OrderType order_type = {};
+    roq::TimeInForce time_in_force = {};
+    roq::Mask<roq::ExecutionInstruction> execution_instructions;
+    std::string request_template;
+    double quantity = NaN;
+    double price = NaN;
+    double stop_price = NaN;
+    std::string routing_id;
+    uint32_t strategy_id = {};
+  };
+
+  struct ModifyOrder final {
+    using value_type = roq::ModifyOrder;
+
+    explicit ModifyOrder(value_type const &value)
+        : account{value.account}, order_id{value.order_id}, request_template{value.request_template},
+          quantity{value.quantity}, price{value.price}, routing_id{value.routing_id}, version{value.version},
+          conditional_on_version{value.conditional_on_version} {}
+
+    operator value_type() const {
+      return {
+          .account = account,
+          .order_id = order_id,
+          .request_template = request_template,
+          .quantity = quantity,
+          .price = price,
+          .routing_id = routing_id,
+          .version = version,
+          .conditional_on_version = conditional_on_version,
+      };
+    }
+
+    std::string account;
+    uint32_t order_id = {};
+    std::string request_template;
+    double quantity = NaN;
+    double price = NaN;
+    std::string routing_id;
+    uint32_t version = {};
+    uint32_t conditional_on_version = {};
+  };
+
+  struct CancelOrder final {
+    using value_type = roq::CancelOrder;
+
+    explicit CancelOrder(value_type const &value)
+        : account{value.account}, order_id{value.order_id}, request_template{value.request_template},
+          routing_id{value.routing_id}, version{value.version},
+          conditional_on_version{value.conditional_on_version} {}
+
+    operator value_type() const {
+      return {
+          .account = account,
+          .order_id = order_id,
+          .request_template = request_template,
+          .routing_id = routing_id,
+          .version = version,
+          .conditional_on_version = conditional_on_version,
+      };
+    }
+
+    std::string account;
+    uint32_t order_id = {};
+    std::string request_template;
+    std::string routing_id;
+    uint32_t version = {};
+    uint32_t conditional_on_version = {};
+  };
+
+  struct CancelAllOrders final {
+    using value_type = roq::CancelAllOrders;
+
+    explicit CancelAllOrders(value_type const &value)
+        : account{value.account}, order_id{value.order_id}, exchange{value.exchange}, symbol{value.symbol},
+          strategy_id{value.strategy_id}, side{value.side} {}
+
+    operator value_type() const {
+      return {
+          .account = account,
+          .order_id = order_id,
+          .exchange = exchange,
+          .symbol = symbol,
+          .strategy_id = strategy_id,
+          .side = side,
+      };
+    }
+
+    std::string account;
+    uint32_t order_id = {};
+    std::string exchange;
+    std::string symbol;
+    uint32_t strategy_id = {};
+    roq::Side side = {};
+  };
+
+  using request_type = std::variant<CreateOrder, ModifyOrder, CancelOrder, CancelAllOrders>;
+
+  bool empty() const { return !size(); }
+
+  size_t size() const {
+    size_t result = {};
+    for (auto &item : queues_)
+      for (auto &item_2 : item.second)
+        result += std::size(item_2.second);
+    return result;
+  }
+
+  // note! returns the number of requests dropped
+  size_t clear() {
+    auto result = size();
+    queues_.clear();
+    return result;
+  }
+
+  // note! e.g. disconnect, queued requests are not valid against the gateway's new order state
+  size_t clear(uint8_t source) {
+    size_t result = {};
+    if (auto iter = queues_.find(source); iter != std::end(queues_)) {
+      for (auto &item : (*iter).second)
+        result += std::size(item.second);
+      queues_.erase(iter);
+    }
+    sources_.erase(source);
+    return result;
+  }
+
+  // note! an empty account means the limits apply to all accounts (of that source)
+  void operator()(roq::RateLimitsUpdate const &rate_limits_update, uint8_t source) {
+    auto &limits = get_or_create(source, static_cast<std::string_view>(rate_limits_update.account)).limits;
+    for (auto &item : rate_limits_update.rate_limits) {
+      auto iter = std::find_if(std::begin(limits), std::end(limits), [&](auto &limit) {
+        return limit.type == item.type && limit.period == item.period;
+      });
+      Limit limit{
+          .type = item.type,
+          .period = item.period,
+          .end_time_utc = item.end_time_utc,
+          .limit = item.limit,
+          .value = item.value,
+      };
+      if (iter != std::end(limits))
+        *iter = limit;
+      else
+        limits.emplace_back(limit);
+    }
+  }
+
+  // note! ban_expires is cleared when the trigger has been released
+  void operator()(roq::RateLimitTrigger const &rate_limit_trigger, uint8_t source) {
+    if (std::empty(rate_limit_trigger.accounts)) {
+      get_or_create(source, std::string_view{}).ban_expires = rate_limit_trigger.ban_expires;
+    } else {
+      for (auto &item : rate_limit_trigger.accounts)
+        get_or_create(source, static_cast<std::string_view>(item)).ban_expires = rate_limit_trigger.ban_expires;
+    }
+  }
+
+  template <typename T, typename Send>
+  void operator()(T const &value, uint8_t source, std::chrono::nanoseconds now, Send const &send) {
+    auto account = static_cast<std::string_view>(value.account);
+    auto queue = find(source, account);
+    if ((queue == nullptr || std::empty(*queue)) && can_send(source, account, now)) {
+      send(value, source);
+      consume(source, account, now);
+      return;
+    }
+    enqueue(get_or_create_queue(source, account), value);
+  }
+
+  template <typename Send>
+  size_t drain(std::chrono::nanoseconds now, Send const &send) {
+    size_t result = {};
+    for (auto &[source, accounts] : queues_) {
+      for (auto &[account, queue] : accounts) {
+        while (!std::empty(queue) && can_send(source, account, now)) {
+          // note! removed before sending, i.e. a failing request doesn't block the queue
+          auto request = std::move(queue.front());
+          queue.pop_front();
+          std::visit(
+              [&](auto &item) {
+                using value_type = typename std::remove_cvref<decltype(item)>::type::value_type;
+                send(static_cast<value_type>(item), source);
+              },
+              request);
+          consume(source, account, now);
+          ++result;
+        }
+      }
+    }
+    return result;
+  }
+
+ protected:
+  struct Limit final {
+    roq::RateLimitType type = {};
+    std::chrono::nanoseconds period = {};
+    std::chrono::nanoseconds end_time_utc = {};
+    uint64_t limit = {};
+    uint64_t value = {};
+  };
+
+  struct Account final {
+    std::vector<Limit> limits;
+    std::chrono::nanoseconds ban_expires = {};
+  };
+
+  using queue_type = std::deque<request_type>;
+
+  queue_type *find(uint8_t source, std::string_view const &account) {
+    auto iter_0 = queues_.find(source);
+    if (iter_0 == std::end(queues_))
+      return nullptr;
+    auto iter_1 = (*iter_0).second.find(account);
+    if (iter_1 == std::end((*iter_0).second))
+      return nullptr;
+    return &(*iter_1).second;
+  }
+
+  queue_type &get_or_create_queue(uint8_t source, std::string_view const &account) {
+    auto &accounts = queues_[source];
+    auto iter = accounts.find(account);
+    if (iter == std::end(accounts))
+      iter = accounts.try_emplace(std::string{account}).first;
+    return (*iter).second;
+  }
+
+  void enqueue(queue_type &queue, roq::CreateOrder const &value) { queue.emplace_back(CreateOrder{value}); }
+
+  // note! the queue is already specific to (source, account)
+  template <typename T>
+  static ModifyOrder *find_modify_order(request_type &item, T const &value) {
+    auto modify_order = std::get_if<ModifyOrder>(&item);
+    if (modify_order && (*modify_order).order_id == value.order_id)
+      return modify_order;
+    return nullptr;
+  }
+
+  // note! conditional on the superseded version (never sent) means conditional on what it was conditional on
+  template <typename T>
+  static void inherit_conditional_on_version(T &value, ModifyOrder const &superseded) {
+    if (value.conditional_on_version && value.conditional_on_version == superseded.version)
+      value.conditional_on_version = superseded.conditional_on_version;
+  }
+
+  void enqueue(queue_type &queue, roq::ModifyOrder const &value) {
+    auto iter = std::find_if(
+        std::begin(queue), std::end(queue), [&](auto &item) { return find_modify_order(item, value) != nullptr; });
+    if (iter != std::end(queue)) {
+      ModifyOrder modify_order{value};
+      inherit_conditional_on_version(modify_order, std::get<ModifyOrder>(*iter));
+      *iter = std::move(modify_order);
+    } else {
+      queue.emplace_back(ModifyOrder{value});
+    }
+  }
+
+  void enqueue(queue_type &queue, roq::CancelOrder const &value) {
+    CancelOrder cancel_order{value};
+    std::erase_if(queue, [&](auto &item) {
+      auto modify_order = find_modify_order(item, value);
+      if (modify_order == nullptr)
+        return false;
+      inherit_conditional_on_version(cancel_order, *modify_order);
+      return true;
+    });
+    queue.emplace_back(std::move(cancel_order));
+  }
+
+  void enqueue(queue_type &queue, roq::CancelAllOrders const &value) { queue.emplace_back(CancelAllOrders{value}); }
+
+  Account &get_or_create(uint8_t source, std::string_view const &account) {
+    auto &accounts = sources_[source];
+    auto iter = accounts.find(account);
+    if (iter == std::end(accounts))
+      iter = accounts.try_emplace(std::string{account}).first;
+    return (*iter).second;
+  }
+
+  bool can_send(uint8_t source, std::string_view const &account, std::chrono::nanoseconds now) {
+    auto iter_0 = sources_.find(source);
+    if (iter_0 == std::end(sources_))
+      return true;
+    auto &accounts = (*iter_0).second;
+    auto helper = [&](auto &state) {
+      if (now < state.ban_expires)
+        return false;
+      for (auto &item : state.limits) {
+        roll(item, now);
+        if (item.limit && item.value >= item.limit)
+          return false;
+      }
+      return true;
+    };
+    if (auto iter = accounts.find(std::string_view{}); iter != std::end(accounts) && !helper((*iter).second))
+      return false;
+    if (std::empty(account))
+      return true;
+    if (auto iter = accounts.find(account); iter != std::end(accounts) && !helper((*iter).second))
+      return false;
+    return true;
+  }
+
+  void consume(uint8_t source, std::string_view const &account, std::chrono::nanoseconds now) {
+    auto iter_0 = sources_.find(source);
+    if (iter_0 == std::end(sources_))
+      return;
+    auto &accounts = (*iter_0).second;
+    auto helper = [&](auto &state) {
+      for (auto &item : state.limits) {
+        roll(item, now);
+        ++item.value;
+      }
+    };
+    if (auto iter = accounts.find(std::string_view{}); iter != std::end(accounts))
+      helper((*iter).second);
+    if (std::empty(account))
+      return;
+    if (auto iter = accounts.find(account); iter != std::end(accounts))
+      helper((*iter).second);
+  }
+
+  // note! the gateway only reports the current window, we assume it rolls forward by period
+  static void roll(Limit &limit, std::chrono::nanoseconds now) {
+    if (now < limit.end_time_utc)
+      return;
+    limit.value = {};
+    if (limit.period.count() > 0)
+      limit.end_time_utc += ((now - limit.end_time_utc) / limit.period + 1) * limit.period;
+  }
+
+ private:
+  std::map<uint8_t, std::map<std::string, Account, std::less<>>> sources_;
+  std::map<uint8_t, std::map<std::string, queue_type, std::less<>>> queues_;
+};
+
+}  // namespace client
+}  // namespace python
+}  // namespace roq
@@ -0,0 +1,143 @@
+/* Copyright (c) 2017-2024, Hans Erik Thrane */
+
+#pragma once
+
+#include <pybind11/numpy.h>
+#include <pybind11/pybind11.h>
+
+#include <fmt/format.h>
+
+#include <chrono>
+#include <cstdint>
+#include <iterator>
+#include <ratio>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "roq/python/fields.hpp"
+#include "roq/python/utils.hpp"
+
+namespace roq {
+namespace python {
+namespace codec {
+namespace fix {
+
+// note!
+//   accumulates the values of a single field and converts them to a numpy array
+//   time fields are returned as datetime64[ns] / timedelta64[ns], or int64 (nanoseconds) when requested
+//   enums and strings are returned as object arrays
+
+template <typename T>
+struct is_hh_mm_ss final : std::false_type {};
+
+template <typename T>
+struct is_hh_mm_ss<std::chrono::hh_mm_ss<T>> final : std::true_type {};
+
+struct Column final {
+  enum class Type : uint8_t {
+    UNDEFINED,
+    FLOAT,
+    INTEGER,
+    BOOL,
+    STRING,
+    DATETIME,
+    TIMEDELTA,
+  };
+
+  Column(std::string_view const &name, bool nanoseconds) : name{name}, nanoseconds{nanoseconds} {}
+
+  template <typename T>
+  void append(T const &value) {
+    using namespace std::literals;
+    if constexpr (utils::is_span<T>::value) {
+      // note! repeating groups are not supported
+    } else if constexpr (requires { value.value; }) {
+      type = Type::FLOAT;
+      floats.emplace_back(value.value);
+    } else if constexpr (std::is_same<T, bool>::value) {
+      type = Type::BOOL;
+      bools.emplace_back(value);
+    } else if constexpr (std::is_floating_point<T>::value) {
+      type = Type::FLOAT;
+      floats.emplace_back(value);
+    } else if constexpr (std::is_enum<T>::value) {
+      type = Type::STRING;
+      strings.emplace_back(magic_enum::enum_name(value));
+    } else if constexpr (std::is_integral<T>::value) {
+      type = Type::INTEGER;
+      integers.emplace_back(static_cast<int64_t>(value));
+    } else if constexpr (std::is_convertible<T, std::string_view>::value) {
+      type = Type::STRING;
+      strings.emplace_back(static_cast<std::string_view>(value));
+    } else if constexpr (std::is_same<T, std::chrono::year_month_day>::value) {
+      type = nanoseconds ? Type::INTEGER : Type::DATETIME;
+      integers.emplace_back(utils::to_nanoseconds(value));
+    } else if constexpr (is_hh_mm_ss<T>::value) {
+      type = nanoseconds ? Type::INTEGER : Type::TIMEDELTA;
+      integers.emplace_back(utils::to_nanoseconds(value));
+    } else if constexpr (utils::is_duration<T>::value) {
+      // note! second (or lower) resolution is assumed to be an interval, anything else a time point
+      if (nanoseconds)
+        type = Type::INTEGER;
+      else if constexpr (std::ratio_greater_equal<typename T::period, std::ratio<1>>::value)
+        type = Type::TIMEDELTA;
+      else
+        type = Type::DATETIME;
+      integers.emplace_back(utils::to_nanoseconds(value));
+    } else {
+      type = Type::STRING;
+      strings.emplace_back(fmt::format("{}"sv, value));
+    }
+  }
+
+  void extend(Column &&other) {
+    if (type == Type::UNDEFINED)
+      type = other.type;
+    floats.insert(std::end(floats), std::begin(other.floats), std::end(other.floats));
+    integers.insert(std::end(integers), std::begin(other.integers), std::end(other.integers));
+    bools.insert(std::end(bools), std::begin(other.bools), std::end(other.bools));
+    strings.insert(
+        std::end(strings),
+        std::make_move_iterator(std::begin(other.strings)),
+        std::make_move_iterator(std::end(other.strings)));
+  }
+
+  pybind11::object to_array() const {
+    switch (type) {
+      case Type::UNDEFINED:
+        break;
+      case Type::FLOAT:
+        return pybind11::array_t<double>(std::size(floats), std::data(floats));
+      case Type::INTEGER:
+        return pybind11::array_t<int64_t>(std::size(integers), std::data(integers));
+      case Type::BOOL:
+        return pybind11::array_t<bool>(std::size(bools), reinterpret_cast<bool const *>(std::data(bools)));
+      case Type::STRING: {
+        pybind11::list result;
+        for (auto &item : strings)
+          result.append(pybind11::str{item});
+        return pybind11::module_::import("numpy").attr("array")(result, pybind11::arg("dtype") = "O");
+      }
+      case Type::DATETIME:
+        return pybind11::array_t<int64_t>(std::size(integers), std::data(integers)).attr("view")("datetime64[ns]");
+      case Type::TIMEDELTA:
+        return pybind11::array_t<int64_t>(std::size(integers), std::data(integers)).attr("view")("timedelta64[ns]");
+    }
+    return pybind11::array_t<double>(0);
+  }
+
+  std::string const name;
+  bool const nanoseconds;
+  Type type = {};
+  std::vector<double> floats;
+  std::vector<int64_t> integers;
+  std::vector<uint8_t> bools;
+  std::vector<std::string> strings;
+};
+
+}  // namespace fix
+}  // namespace codec
+}  // namespace python
+}  // namespace roq
@@ -0,0 +1,359 @@
+/* Copyright (c) 2017-2024, Hans Erik Thrane */
+
+#define PYBIND11_DETAILED_ERROR_MESSAGES
+
+#include "roq/python/codec/fix/decode_file.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <pybind11/numpy.h>
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <exception>
+#include <system_error>
+#include <thread>
+#include <type_traits>
+
+#include "roq/python/utils.hpp"
+
+#include "roq/python/codec/fix/column.hpp"
+#include "roq/python/codec/fix/decoder.hpp"
+#include "roq/python/codec/fix/fields.hpp"
+
+using namespace std::literals;
+
+namespace roq {
+namespace python {
+namespace codec {
+namespace fix {
+
+namespace {
+constexpr char SOH = '\x01';
+
+// read-only memory map
+
+struct File final {
+  explicit File(std::string_view const &path) {
+    std::string path_2{path};
+    fd_ = ::open(path_2.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd_ < 0)
+      throw std::system_error{errno, std::generic_category(), "open"s};
+    struct stat stat = {};
+    if (::fstat(fd_, &stat) < 0) {
+      auto error = errno;
+      ::close(fd_);
+      throw std::system_error{error, std::generic_category(), "fstat"s};
+    }
+    size_ = static_cast<size_t>(stat.st_size);
+    if (!size_)
+      return;
+    auto data = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd_, 0);
+    if (data == MAP_FAILED) {
+      auto error = errno;
+      ::close(fd_);
+      throw std::system_error{error, std::generic_category(), "mmap"s};
+    }
+    data_ = static_cast<char const *>(data);
+  }
+
+  File(File const &) = delete;
+
+  ~File() {
+    if (data_ != nullptr)
+      ::munmap(const_cast<char *>(data_), size_);
+    ::close(fd_);
+  }
+
+  operator std::string_view() const { return {data_, size_}; }
+
+ private:
+  int fd_ = -1;
+  char const *data_ = nullptr;
+  size_t size_ = {};
+};
+
+// note! invalid request (as opposed to a malformed message)
+
+struct InvalidField final : public std::invalid_argument {
+  using std::invalid_argument::invalid_argument;
+};
+
+// table (one per message type)
+
+struct Table final {
+  explicit Table(std::vector<std::string> const &names) : names_{names} {}
+
+  template <typename T>
+  void append(roq::fix::Header const &header, T const &value) {
+    if (!initialized_) [[unlikely]]
+      initialize(header, value);
+    size_t index = {};
+    auto helper = [&]([[maybe_unused]] auto const &name, auto const &field) {
+      auto column = mapping_[index++];
+      if (column >= 0)
+        columns_[column].append(field);
+    };
+    utils::Fields<roq::fix::Header>::apply(header, helper);
+    utils::Fields<T>::apply(value, helper);
+  }
+
+  void extend(Table &&other) {
+    if (!other.initialized_)
+      return;
+    if (!initialized_) {
+      columns_ = std::move(other.columns_);
+      initialized_ = other.initialized_;
+      return;
+    }
+    for (size_t i = 0; i < std::size(columns_); ++i)
+      columns_[i].extend(std::move(other.columns_[i]));
+  }
+
+  pybind11::dict to_dict() const {
+    pybind11::dict result;
+    for (auto &column : columns_)
+      result[pybind11::str{column.name}] = column.to_array();
+    return result;
+  }
+
+ protected:
+  // note! columns are ordered as requested (or as the fields, if none were requested)
+  template <typename T>
+  void initialize(roq::fix::Header const &header, T const &value) {
+    std::vector<std::string_view> available;
+    std::vector<bool> scalar;
+    auto helper = [&](std::string_view const &name, auto const &field) {
+      available.emplace_back(name);
+      scalar.emplace_back(!utils::is_span<std::remove_cvref_t<decltype(field)>>::value);
+    };
+    utils::Fields<roq::fix::Header>::apply(header, helper);
+    utils::Fields<T>::apply(value, helper);
+    mapping_.assign(std::size(available), -1);
+    if (std::empty(names_)) {
+      for (size_t i = 0; i < std::size(available); ++i) {
+        if (!scalar[i])
+          continue;
+        mapping_[i] = static_cast<int>(std::size(columns_));
+        columns_.emplace_back(available[i], false);
+      }
+    } else {
+      for (auto &name : names_) {
+        std::string_view name_2{name};
+        auto nanoseconds = name_2.ends_with("_ns"sv);
+        auto found = false;
+        for (size_t i = 0; i < std::size(available) && !found; ++i) {
+          if (available[i] != name_2 && !(nanoseconds && available[i] == name_2.substr(0, std::size(name_2) - 3)))
+            continue;
+          if (!scalar[i])
+            throw InvalidField{fmt::format(R"(Repeating group "{}" is not supported)"sv, name)};
+          mapping_[i] = static_cast<int>(std::size(columns_));
+          columns_.emplace_back(name, available[i] != name_2);
+          found = true;
+        }
+        if (!found)
+          throw InvalidField{fmt::format(R"(Unknown field "{}")"sv, name)};
+      }
+    }
+    initialized_ = true;
+  }
+
+ private:
+  std::vector<std::string> const names_;
+  bool initialized_ = false;
+  std::vector<int> mapping_;
+  std::vector<Column> columns_;
+};
+
+// worker (one per chunk)
+
+struct Worker final {
+  Worker(
+      std::vector<roq::fix::MsgType> const &msg_types,
+      std::map<roq::fix::MsgType, std::vector<std::string>> const &fields)
+      : decoder_{roq::codec::fix::Decoder::create()}, fields_{fields} {
+    for (auto msg_type : msg_types)
+      get_or_create(msg_type);
+    all_ = std::empty(msg_types);
+  }
+
+  void operator()(std::string_view const &chunk) {
+    try {
+      parse(chunk);
+    } catch (...) {
+      exception_ = std::current_exception();
+    }
+  }
+
+  // note! called by the decoder
+  template <typename T>
+  bool operator()(roq::fix::Header const &header, T const &value) {
+    auto iter = tables_.find(header.msg_type);
+    if (iter != std::end(tables_))
+      (*iter).second.append(header, value);
+    else if (all_)
+      get_or_create(header.msg_type).append(header, value);
+    return false;
+  }
+
+  std::map<roq::fix::MsgType, Table> &tables() { return tables_; }
+
+  void rethrow() {
+    if (exception_)
+      std::rethrow_exception(exception_);
+  }
+
+  // note! message starts with BeginString (not preceded by a digit, e.g. 58=FIX...)
+  static size_t find_begin(std::string_view const &data, size_t offset) {
+    while (offset < std::size(data)) {
+      auto result = data.find("8=FIX"sv, offset);
+      if (result == data.npos)
+        return data.npos;
+      if (!result || !std::isdigit(static_cast<unsigned char>(data[result - 1])))
+        return result;
+      offset = result + 1;
+    }
+    return data.npos;
+  }
+
+ protected:
+  Table &get_or_create(roq::fix::MsgType msg_type) {
+    auto iter = tables_.find(msg_type);
+    if (iter == std::end(tables_)) {
+      auto iter_2 = fields_.find(msg_type);
+      auto &names = iter_2 != std::end(fields_) ? (*iter_2).second : empty_;
+      iter = tables_.try_emplace(msg_type, names).first;
+    }
+    return (*iter).second;
+  }
+
+  void parse(std::string_view const &chunk) {
+    struct Noop final {
+      void operator()(pybind11::object, pybind11::object) const {}
+    } noop;
+    Decoder::Handler handler{noop, false, *this};
+    size_t offset = {};
+    while (true) {
+      auto begin = find_begin(chunk, offset);
+      if (begin == chunk.npos)
+        break;
+      // note! the separator is the first non-printable character or '|' following BeginString
+      auto separator = chunk.find_first_of("\x01|"sv, begin);
+      if (separator == chunk.npos)
+        break;
+      auto soh = chunk[separator];
+      char trailer[] = {soh, '1', '0', '='};
+      auto checksum = chunk.find(std::string_view{trailer, std::size(trailer)}, separator);
+      if (checksum == chunk.npos)
+        break;
+      auto end = chunk.find(soh, checksum + std::size(trailer));
+      if (end == chunk.npos)
+        break;
+      auto message = chunk.substr(begin, end + 1 - begin);
+      offset = end + 1;
+      try {
+        decode(handler, message, soh, checksum + 1 - begin);
+      } catch (InvalidField &) {
+        throw;
+      } catch (std::exception &) {
+        // note! malformed
+      }
+    }
+  }
+
+  // note! '|' separated messages are converted (and the checksum is re-computed)
+  template <typename Handler>
+  void decode(Handler &handler, std::string_view const &message, char separator, size_t trailer) {
+    auto helper = [&](auto const &buffer) {
+      std::span buffer_2{reinterpret_cast<std::byte const *>(std::data(buffer)), std::size(buffer)};
+      (*decoder_)(handler, buffer_2);
+    };
+    if (separator == SOH) {
+      helper(message);
+      return;
+    }
+    buffer_.assign(std::begin(message), std::end(message));
+    uint32_t checksum = {};
+    for (size_t i = 0; i < std::size(buffer_); ++i) {
+      if (buffer_[i] == '|')
+        buffer_[i] = SOH;
+      if (i < trailer)
+        checksum += static_cast<uint8_t>(buffer_[i]);
+    }
+    auto digits = fmt::format("{:03}"sv, checksum % 256);
+    if ((trailer + 3 + std::size(digits)) <= std::size(buffer_))
+      std::copy(std::begin(digits), std::end(digits), std::begin(buffer_) + trailer + 3);
+    helper(buffer_);
+  }
+
+ private:
+  std::unique_ptr<roq::codec::fix::Decoder> decoder_;
+  std::map<roq::fix::MsgType, std::vector<std::string>> const &fields_;
+  std::vector<std::string> const empty_;
+  bool all_ = false;
+  std::map<roq::fix::MsgType, Table> tables_;
+  std::string buffer_;
+  std::exception_ptr exception_;
+};
+}  // namespace
+
+pybind11::dict decode_file(
+    std::string_view const &path,
+    std::vector<roq::fix::MsgType> const &msg_types,
+    std::map<roq::fix::MsgType, std::vector<std::string>> const &fields,
+    size_t threads) {
+  File file{path};
+  std::string_view data{file};
+  threads = std::max<size_t>(threads, 1);
+  std::vector<Worker> workers;
+  workers.reserve(threads);
+  for (size_t i = 0; i < threads; ++i)
+    workers.emplace_back(msg_types, fields);
+  {
+    pybind11::gil_scoped_release release;
+    // note! chunks are aligned to the start of a message
+    std::vector<size_t> offsets;
+    for (size_t i = 0; i < threads; ++i) {
+      auto offset = Worker::find_begin(data, (std::size(data) * i) / threads);
+      offsets.emplace_back(std::min(offset, std::size(data)));
+    }
+    offsets.emplace_back(std::size(data));
+    auto chunk = [&](size_t index) { return data.substr(offsets[index], offsets[index + 1] - offsets[index]); };
+    if (threads == 1) {
+      workers[0](chunk(0));
+    } else {
+      std::vector<std::thread> tmp;
+      for (size_t i = 0; i < threads; ++i)
+        tmp.emplace_back([&, i]() { workers[i](chunk(i)); });
+      for (auto &item : tmp)
+        item.join();
+    }
+  }
+  for (auto &worker : workers)
+    worker.rethrow();
+  auto &result = workers[0].tables();
+  for (size_t i = 1; i < threads; ++i) {
+    for (auto &[msg_type, table] : workers[i].tables()) {
+      auto iter = result.find(msg_type);
+      if (iter == std::end(result))
+        result.try_emplace(msg_type, std::move(table));
+      else
+        (*iter).second.extend(std::move(table));
+    }
+  }
+  pybind11::dict result_2;
+  for (auto &[msg_type, table] : result)
+    result_2[pybind11::cast(msg_type)] = table.to_dict();
+  return result_2;
+}
+
+}  // namespace fix
+}  // namespace codec
+}  // namespace python
+}  // namespace roq
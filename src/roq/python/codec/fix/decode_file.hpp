@@ -0,0 +1,37 @@
+/* Copyright (c) 2017-2024, Hans Erik Thrane */
+
+#pragma once
+
+#include <pybind11/pybind11.h>
+
+#include <map>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "roq/fix/header.hpp"
+
+namespace roq {
+namespace python {
+namespace codec {
+namespace fix {
+
+// note!
+//   decodes a FIX capture (SOH or '|' separated, any prefix before BeginString is ignored)
+//   returns {msg_type: {field: numpy array}}
+//   empty msg_types means all message types, missing (or empty) fields means all scalar fields
+//   header fields (msg_seq_num, sending_time, ...) can be requested as well
+//   time fields are returned as datetime64[ns] / timedelta64[ns], or int64 (nanoseconds) when the name has a _ns suffix
+//   enums and strings are returned as object arrays
+//   malformed messages are skipped
+
+pybind11::dict decode_file(
+    std::string_view const &path,
+    std::vector<roq::fix::MsgType> const &msg_types,
+    std::map<roq::fix::MsgType, std::vector<std::string>> const &fields,
+    size_t threads);
+
+}  // namespace fix
+}  // namespace codec
+}  // namespace python
+}  // namespace roq
@@ -4,8 +4,15 @@
 
 #include <pybind11/pybind11.h>
 
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
 #include "roq/codec/fix/decoder.hpp"
 
+#include "roq/python/utils.hpp"
+
 #include "roq/python/codec/fix/details.hpp"
 #include "roq/python/codec/fix/header.hpp"
 
@@ -15,12 +22,56 @@ namespace codec {
 namespace fix {
 
 struct Decoder final {
-  template <typename Callback>
+  // note! an empty allow-list means all message types are dispatched
+  struct Filter final {
+    explicit Filter(std::vector<roq::fix::MsgType> const &msg_types) {
+      if (std::empty(msg_types))
+        return;
+      allowed_.resize(magic_enum::enum_count<roq::fix::MsgType>());
+      for (auto msg_type : msg_types)
+        if (auto index = magic_enum::enum_index(msg_type); index.has_value())
+          allowed_[*index] = true;
+    }
+
+    template <typename T>
+    bool operator()(roq::fix::Header const &header, [[maybe_unused]] T const &value) {
+      if (std::empty(allowed_))
+        return true;
+      auto index = magic_enum::enum_index(header.msg_type);
+      if (index.has_value() && allowed_[*index])
+        return true;
+      ++skipped_;
+      return false;
+    }
+
+    size_t skipped() const { return skipped_; }
+
+   private:
+    std::vector<bool> allowed_;
+    size_t skipped_ = {};
+  };
+
+  // note! the filter is called before the conversion to python and may consume the message (by returning false)
+  template <typename Callback, typename F = Filter>
   struct Handler final : public roq::codec::fix::Decoder::Handler {
-    explicit Handler(Callback const &callback) : callback_{callback} {}
+    Handler(Callback const &callback, bool view, F &filter) : callback_{callback}, view_{view}, filter_{filter} {}
 
+    // note! view mode passes references to the decoded message (the user is therefore not allowed to keep handles)
     template <typename T>
     void dispatch(auto &header, auto &value) {
+      if (!filter_(header, value))
+        return;
+      if (view_) {
+        using value_type = std::remove_cvref<decltype(value)>::type;
+        auto arg0 = pybind11::cast(utils::Ref<roq::fix::Header>{header});
+        auto arg1 = pybind11::cast(utils::Ref<value_type>{value});
+        callback_(arg0, arg1);
+        if (arg0.ref_count() > 1 || arg1.ref_count() > 1) {
+          using namespace std::literals;
+          throw std::runtime_error{"Objects must not be stored"s};
+        }
+        return;
+      }
       Header header_2{header};
       T value_2{value};
       auto arg0 = pybind11::cast(header_2);
@@ -137,17 +188,32 @@ struct Decoder final {
       dispatch<PositionReport>(header, value);
     }
 
+    // note! the filter may consume a message before it is decoded (returns the length of the message if consumed)
+    size_t intercept(std::span<std::byte const> const &buffer) {
+      if constexpr (requires(F &filter, std::span<std::byte const> const &message) { filter.intercept(message); })
+        return filter_.intercept(buffer);
+      else
+        return 0;
+    }
+
    private:
     Callback const &callback_;
+    bool const view_;
+    F &filter_;
   };
 
-  Decoder() : decoder_{roq::codec::fix::Decoder::create()} {}
+  static constexpr size_t MAXIMUM_MESSAGE_SIZE = 1048576;
+
+  Decoder(
+      bool view, std::vector<roq::fix::MsgType> const &msg_types, size_t maximum_message_size = MAXIMUM_MESSAGE_SIZE)
+      : decoder_{roq::codec::fix::Decoder::create()}, view_{view}, filter_{msg_types},
+        maximum_message_size_{maximum_message_size} {}
 
   template <typename Callback>
   size_t dispatch(Callback const &callback, std::string_view const &message) {
     size_t result = {};
     try {
-      Handler handler{callback};
+      Handler handler{callback, view_, filter_};
       std::span buffer{reinterpret_cast<std::byte const *>(std::data(message)), std::size(message)};
       result = (*decoder_)(handler, buffer);
     } catch (pybind11::error_already_set &) {
@@ -164,10 +230,85 @@ struct Decoder final {
     return result;
   }
 
+  // note! decodes a single (complete) message, the filter's intercept is not called
+  template <typename Callback, typename F>
+  size_t dispatch(Callback const &callback, F &filter, std::span<std::byte const> const &message) {
+    Handler handler{callback, view_, filter};
+    return (*decoder_)(handler, message);
+  }
+
+  // note!
+  //   streaming, complete messages are decoded directly from the caller's buffer
+  //   any trailing partial message is retained internally and completed by the following call(s)
+  //   returns the number of bytes consumed, i.e. complete messages decoded by this call (including retained data)
+  //   an exception (e.g. raised by the callback) retains the unprocessed tail, starting with the failed message
+  //     (the following call will therefore dispatch that message again, use reset() to discard)
+  //   a partial message exceeding maximum_message_size is considered a corrupt stream (retained data is discarded)
+  template <typename Callback>
+  size_t feed(Callback const &callback, std::span<std::byte const> const &buffer) {
+    return feed(callback, filter_, buffer);
+  }
+
+  template <typename Callback, typename F>
+  size_t feed(Callback const &callback, F &filter, std::span<std::byte const> const &buffer) {
+    Handler handler{callback, view_, filter};
+    size_t result = {};
+    if (std::empty(buffer_)) {
+      try {
+        decode(handler, buffer, result);
+      } catch (...) {
+        buffer_.assign(std::begin(buffer) + result, std::end(buffer));
+        throw;
+      }
+      buffer_.assign(std::begin(buffer) + result, std::end(buffer));
+    } else {
+      buffer_.insert(std::end(buffer_), std::begin(buffer), std::end(buffer));
+      try {
+        decode(handler, buffer_, result);
+      } catch (...) {
+        buffer_.erase(std::begin(buffer_), std::begin(buffer_) + result);
+        throw;
+      }
+      buffer_.erase(std::begin(buffer_), std::begin(buffer_) + result);
+    }
+    if (std::size(buffer_) > maximum_message_size_) {
+      buffer_.clear();
+      using namespace std::literals;
+      throw std::runtime_error{"Message exceeds maximum size"s};
+    }
+    return result;
+  }
+
+  size_t pending() const { return std::size(buffer_); }
+
+  void reset() { buffer_.clear(); }
+
+  size_t skipped() const { return filter_.skipped(); }
+
   // XXX HANS tuple
 
+ protected:
+  // note! result is updated after each message (i.e. reflects progress if an exception is thrown)
+  template <typename Callback, typename F>
+  void decode(Handler<Callback, F> &handler, std::span<std::byte const> const &buffer, size_t &result) {
+    while (result < std::size(buffer)) {
+      if (auto length = handler.intercept(buffer.subspan(result)); length) {
+        result += length;
+        continue;
+      }
+      auto length = (*decoder_)(handler, buffer.subspan(result));
+      if (!length)
+        break;
+      result += length;
+    }
+  }
+
  private:
   std::unique_ptr<roq::codec::fix::Decoder> decoder_;
+  bool const view_;
+  Filter filter_;
+  size_t const maximum_message_size_;
+  std::vector<std::byte> buffer_;
 };
 
 }  // namespace fix
@@ -8,9 +8,16 @@
 #include <pybind11/functional.h>
 #include <pybind11/stl.h>
 
+#include <ranges>
+
 #include "roq/python/utils.hpp"
+#include "roq/python/view.hpp"
 
 #include "roq/python/codec/fix/decoder.hpp"
+#include "roq/python/codec/fix/group.hpp"
+#include "roq/python/codec/fix/market_data.hpp"
+#include "roq/python/codec/fix/order_template.hpp"
+#include "roq/python/codec/fix/session.hpp"
 
 using namespace std::literals;
 
@@ -70,9 +77,19 @@ void utils::create_struct<roq::python::codec::fix::MDFull>(pybind11::module_ &mo
       .def_property_readonly(
           "md_entry_date",
           [](value_type const &self) { return static_cast<value_type::value_type>(self).md_entry_date; })
+      .def_property_readonly(
+          "md_entry_date_ns",
+          [](value_type const &self) {
+            return utils::to_nanoseconds(static_cast<value_type::value_type>(self).md_entry_date);
+          })
       .def_property_readonly(
           "md_entry_time",
           [](value_type const &self) { return static_cast<value_type::value_type>(self).md_entry_time; })
+      .def_property_readonly(
+          "md_entry_time_ns",
+          [](value_type const &self) {
+            return utils::to_nanoseconds(static_cast<value_type::value_type>(self).md_entry_time);
+          })
       .def_property_readonly(
           "trading_session_id",
           [](value_type const &self) { return static_cast<value_type::value_type>(self).trading_session_id; })
@@ -116,9 +133,19 @@ void utils::create_struct<roq::python::codec::fix::MDInc>(pybind11::module_ &mod
       .def_property_readonly(
           "md_entry_date",
           [](value_type const &self) { return static_cast<value_type::value_type>(self).md_entry_date; })
+      .def_property_readonly(
+          "md_entry_date_ns",
+          [](value_type const &self) {
+            return utils::to_nanoseconds(static_cast<value_type::value_type>(self).md_entry_date);
+          })
       .def_property_readonly(
           "md_entry_time",
           [](value_type const &self) { return static_cast<value_type::value_type>(self).md_entry_time; })
+      .def_property_readonly(
+          "md_entry_time_ns",
+          [](value_type const &self) {
+            return utils::to_nanoseconds(static_cast<value_type::value_type>(self).md_entry_time);
+          })
       .def_property_readonly(
           "trading_session_id",
           [](value_type const &self) { return static_cast<value_type::value_type>(self).trading_session_id; })
@@ -143,9 +170,11 @@ void utils::create_struct<roq::python::codec::fix::Encoder>(pybind11::module_ &m
   std::string name{nameof::nameof_short_type<value_type>()};
   pybind11::class_<value_type>(module, name.c_str())
       .def(
-          pybind11::init<std::string_view, std::string_view>(),
+          pybind11::init<std::string_view, std::string_view, std::string_view>(),
           pybind11::arg("sender_comp_id"),
-          pybind11::arg("target_comp_id"))
+          pybind11::arg("target_comp_id"),
+          pybind11::arg("journal") = std::string_view{})
+      .def_property_readonly("msg_seq_num", [](value_type const &self) { return self.msg_seq_num(); })
       .def(
           "encode",
           [](value_type &self,
@@ -156,7 +185,213 @@ void utils::create_struct<roq::python::codec::fix::Encoder>(pybind11::module_ &m
             return pybind11::bytes{result};
           },
           pybind11::arg("encodeable"),
-          pybind11::arg("sending_time"));
+          pybind11::arg("sending_time"))
+      .def(
+          "encode_into",
+          [](value_type &self,
+             roq::python::codec::fix::Encodeable &encodeable,
+             std::chrono::system_clock::time_point sending_time,
+             pybind11::buffer buffer,
+             size_t offset) {
+            auto info = buffer.request(true);
+            if (info.itemsize != 1 || info.ndim != 1 || info.strides[0] != 1)
+              throw std::invalid_argument{"Expected a contiguous byte buffer"s};
+            if (offset > static_cast<size_t>(info.size))
+              throw std::out_of_range{"Offset is out of range"s};
+            std::span destination{static_cast<std::byte *>(info.ptr) + offset, static_cast<size_t>(info.size) - offset};
+            return self.encode_into(encodeable, sending_time, destination);
+          },
+          pybind11::arg("encodeable"),
+          pybind11::arg("sending_time"),
+          pybind11::arg("buffer"),
+          pybind11::arg("offset") = 0,
+          "Encode and copy into a writable buffer (bytearray, memoryview, ...), returns number of bytes written")
+      .def(
+          "encode_many",
+          [](value_type &self,
+             std::vector<roq::python::codec::fix::Encodeable const *> const &encodeables,
+             std::chrono::system_clock::time_point sending_time) {
+            // note! validated up front (None is converted to nullptr)
+            for (auto item : encodeables)
+              if (item == nullptr)
+                throw std::invalid_argument{"Encodeable must not be None"s};
+            auto helper = [&](auto &item) -> auto & { return *item; };
+            auto message = self.encode_many(encodeables | std::views::transform(helper), sending_time);
+            std::string_view result{reinterpret_cast<char const *>(std::data(message)), std::size(message)};
+            return pybind11::bytes{result};
+          },
+          pybind11::arg("encodeables"),
+          pybind11::arg("sending_time"),
+          "Encode a sequence of messages into one contiguous buffer");
+}
+
+template <>
+void utils::create_struct<roq::python::codec::fix::OrderTemplate>(pybind11::module_ &module) {
+  using value_type = roq::python::codec::fix::OrderTemplate;
+  std::string name{nameof::nameof_short_type<value_type>()};
+  pybind11::class_<value_type>(module, name.c_str())
+      .def(
+          pybind11::init<
+              roq::python::codec::fix::Encoder &,
+              roq::python::codec::fix::Encodeable const &,
+              uint8_t,
+              uint8_t>(),
+          pybind11::arg("encoder"),
+          pybind11::arg("prototype"),
+          pybind11::arg("price_decimals") = 8,
+          pybind11::arg("quantity_decimals") = 8,
+          pybind11::keep_alive<1, 2>())
+      .def(
+          "encode",
+          [](value_type &self,
+             std::string_view const &cl_ord_id,
+             double price,
+             double quantity,
+             std::chrono::system_clock::time_point sending_time,
+             std::string_view const &orig_cl_ord_id) {
+            auto message = self.encode(cl_ord_id, price, quantity, orig_cl_ord_id, sending_time.time_since_epoch());
+            std::string_view result{reinterpret_cast<char const *>(std::data(message)), std::size(message)};
+            return pybind11::bytes{result};
+          },
+          pybind11::arg("cl_ord_id"),
+          pybind11::arg("price"),
+          pybind11::arg("quantity"),
+          pybind11::arg("sending_time"),
+          pybind11::arg("orig_cl_ord_id") = std::string_view{},
+          "Encode using the encoder's next sequence number");
+}
+
+template <>
+void utils::create_struct<roq::python::codec::fix::Session>(pybind11::module_ &module) {
+  using value_type = roq::python::codec::fix::Session;
+  std::string name{nameof::nameof_short_type<value_type>()};
+  pybind11::class_<value_type>(module, name.c_str())
+      .def(
+          pybind11::init([](std::function<void(pybind11::bytes)> const &send,
+                            std::string_view const &sender_comp_id,
+                            std::string_view const &target_comp_id,
+                            std::string_view const &username,
+                            std::string_view const &password,
+                            std::chrono::seconds heart_bt_int,
+                            bool view,
+                            std::string_view const &journal) {
+            auto send_2 = [send](std::span<std::byte const> const &message) {
+              pybind11::bytes arg0{reinterpret_cast<char const *>(std::data(message)), std::size(message)};
+              send(arg0);
+            };
+            return std::make_unique<value_type>(
+                send_2, sender_comp_id, target_comp_id, username, password, heart_bt_int, view, journal);
+          }),
+          pybind11::arg("send"),
+          pybind11::arg("sender_comp_id"),
+          pybind11::arg("target_comp_id"),
+          pybind11::arg("username") = std::string_view{},
+          pybind11::arg("password") = std::string_view{},
+          pybind11::arg("heart_bt_int") = std::chrono::seconds{30},
+          pybind11::arg("view") = false,
+          pybind11::arg("journal") = std::string_view{})
+      .def_property_readonly("state", [](value_type const &self) { return self.state(); })
+      .def_property(
+          "msg_seq_num",
+          [](value_type const &self) { return self.msg_seq_num(); },
+          [](value_type &self, uint64_t msg_seq_num) { self.set_msg_seq_num(msg_seq_num); })
+      .def_property_readonly("gaps", [](value_type const &self) { return self.gaps(); })
+      .def_property_readonly("duplicates", [](value_type const &self) { return self.duplicates(); })
+      .def_property_readonly("queued", [](value_type const &self) { return self.queued(); })
+      .def("logon", [](value_type &self) { self.logon(); })
+      .def(
+          "logout",
+          [](value_type &self, std::string_view const &text) { self.logout(text); },
+          pybind11::arg("text") = std::string_view{})
+      .def(
+          "send",
+          [](value_type &self, roq::python::codec::fix::Encodeable const &encodeable) { self.send(encodeable); },
+          pybind11::arg("encodeable"))
+      // note! the callback signature **MUST** be pybind11::object so we can verify the reference count hasn't increased
+      .def(
+          "feed",
+          [](value_type &self,
+             std::function<void(pybind11::object, pybind11::object)> &callback,
+             pybind11::buffer buffer) {
+            auto info = buffer.request();
+            if (info.itemsize != 1 || info.ndim != 1 || info.strides[0] != 1) {
+              using namespace std::literals;
+              throw std::invalid_argument{"Expected a contiguous byte buffer"s};
+            }
+            std::span message{static_cast<std::byte const *>(info.ptr), static_cast<size_t>(info.size)};
+            return self.feed(callback, message);
+          },
+          pybind11::arg("callback"),
+          pybind11::arg("buffer"),
+          "Decode all complete messages, only application messages are dispatched")
+      .def(
+          "timer",
+          [](value_type &self) { return self.timer(); },
+          "Drive heartbeats and timeouts, returns False if the connection should be closed");
+}
+
+template <>
+void utils::create_struct<roq::python::codec::fix::MarketDataAdapter>(pybind11::module_ &module) {
+  using value_type = roq::python::codec::fix::MarketDataAdapter;
+  std::string name{nameof::nameof_short_type<value_type>()};
+  pybind11::class_<value_type>(module, name.c_str(), "Applies FIX market data directly to order books (by symbol)")
+      .def(
+          pybind11::init<std::string_view const &, roq::Precision, roq::Precision, bool>(),
+          pybind11::arg("exchange") = std::string_view{},
+          pybind11::arg("price_precision") = roq::Precision{},
+          pybind11::arg("quantity_precision") = roq::Precision{},
+          pybind11::arg("view") = false)
+      // note! the callback signature **MUST** be pybind11::object so we can verify the reference count hasn't increased
+      .def(
+          "feed",
+          [](value_type &self,
+             std::function<void(pybind11::object, pybind11::object)> &callback,
+             std::function<void(std::string_view)> const &update,
+             pybind11::buffer buffer) {
+            auto info = buffer.request();
+            if (info.itemsize != 1 || info.ndim != 1 || info.strides[0] != 1) {
+              using namespace std::literals;
+              throw std::invalid_argument{"Expected a contiguous byte buffer"s};
+            }
+            std::span message{static_cast<std::byte const *>(info.ptr), static_cast<size_t>(info.size)};
+            return self.feed(callback, update, message);
+          },
+          pybind11::arg("callback"),
+          pybind11::arg("update"),
+          pybind11::arg("buffer"),
+          "Decode all complete messages, market data is applied and update is called with the symbol")
+      .def(
+          "book",
+          [](value_type &self, std::string_view const &symbol) -> auto & { return self.get(symbol); },
+          pybind11::arg("symbol"),
+          pybind11::return_value_policy::reference_internal)
+      .def_property_readonly("symbols", [](value_type const &self) { return self.symbols(); })
+      .def(
+          "clear", [](value_type &self) { self.clear(); }, "Reset state (books are cleared, not removed)");
+}
+
+// groups
+
+template <>
+void utils::create_struct<roq::python::codec::fix::Group<roq::python::codec::fix::SecListGrp>>(
+    pybind11::module_ &module) {
+  roq::python::codec::fix::create_group<roq::python::codec::fix::SecListGrp>(module);
+}
+
+template <>
+void utils::create_struct<roq::python::codec::fix::Group<roq::python::codec::fix::InstrmtMDReq>>(
+    pybind11::module_ &module) {
+  roq::python::codec::fix::create_group<roq::python::codec::fix::InstrmtMDReq>(module);
+}
+
+template <>
+void utils::create_struct<roq::python::codec::fix::Group<roq::python::codec::fix::MDFull>>(pybind11::module_ &module) {
+  roq::python::codec::fix::create_group<roq::python::codec::fix::MDFull>(module);
+}
+
+template <>
+void utils::create_struct<roq::python::codec::fix::Group<roq::python::codec::fix::MDInc>>(pybind11::module_ &module) {
+  roq::python::codec::fix::create_group<roq::python::codec::fix::MDInc>(module);
 }
 
 template <>
@@ -417,6 +652,27 @@ void utils::create_ref_struct_2<roq::python::codec::fix::SecurityList, roq::pyth
           pybind11::arg("security_response_id") = std::string_view{},
           pybind11::arg("security_request_result") = roq::fix::SecurityRequestResult{},
           pybind11::arg("no_related_sym") = std::vector<roq::python::codec::fix::SecListGrp>{})
+      .def(
+          pybind11::init([](std::string_view const &security_req_id,
+                            std::string_view const &security_response_id,
+                            roq::fix::SecurityRequestResult security_request_result,
+                            pybind11::dict const &no_related_sym) {
+            return std::make_unique<value_type>(
+                security_req_id,
+                security_response_id,
+                security_request_result,
+                roq::python::codec::fix::from_columns<roq::python::codec::fix::SecListGrp>(no_related_sym));
+          }),
+          pybind11::arg("security_req_id") = std::string_view{},
+          pybind11::arg("security_response_id") = std::string_view{},
+          pybind11::arg("security_request_result") = roq::fix::SecurityRequestResult{},
+          pybind11::arg("no_related_sym"),
+          "Create from columns, i.e. {field: array}")
+      .def_property_readonly(
+          "no_related_sym",
+          utils::create_view_getter([](value_type const &self) {
+            return roq::python::codec::fix::Group<roq::python::codec::fix::SecListGrp>{self.no_related_sym()};
+          }))
       .def("__repr__", [](value_type const &self) {
         return fmt::format("{}"sv, static_cast<value_type::value_type>(self));
       });
@@ -554,6 +810,36 @@ void utils::create_ref_struct_2<roq::python::codec::fix::MarketDataRequest, roq:
           pybind11::arg("aggregated_book") = false,
           pybind11::arg("no_md_entry_types"),  // required
           pybind11::arg("no_related_sym"))     // required
+      .def(
+          pybind11::init([](std::string_view const &md_req_id,
+                            roq::fix::SubscriptionRequestType subscription_request_type,
+                            uint32_t market_depth,
+                            roq::fix::MDUpdateType md_update_type,
+                            bool aggregated_book,
+                            std::vector<roq::fix::MDEntryType> const &no_md_entry_types,
+                            pybind11::dict const &no_related_sym) {
+            return std::make_unique<value_type>(
+                md_req_id,
+                subscription_request_type,
+                market_depth,
+                md_update_type,
+                aggregated_book,
+                no_md_entry_types,
+                roq::python::codec::fix::from_columns<roq::python::codec::fix::InstrmtMDReq>(no_related_sym));
+          }),
+          pybind11::arg("md_req_id"),                  // required
+          pybind11::arg("subscription_request_type"),  // required
+          pybind11::arg("market_depth") = uint32_t{},  // required
+          pybind11::arg("md_update_type") = roq::fix::MDUpdateType{},
+          pybind11::arg("aggregated_book") = false,
+          pybind11::arg("no_md_entry_types"),  // required
+          pybind11::arg("no_related_sym"),     // required
+          "Create from columns, i.e. {field: array}")
+      .def_property_readonly(
+          "no_related_sym",
+          utils::create_view_getter([](value_type const &self) {
+            return roq::python::codec::fix::Group<roq::python::codec::fix::InstrmtMDReq>{self.no_related_sym()};
+          }))
       .def("__repr__", [](value_type const &self) {
         return fmt::format("{}"sv, static_cast<value_type::value_type>(self));
       });
@@ -586,6 +872,32 @@ void utils::create_ref_struct_2<
   using base_type = roq::python::codec::fix::Encodeable;
   std::string name{nameof::nameof_short_type<value_type>()};
   pybind11::class_<value_type, base_type>(module, name.c_str())
+      .def(
+          pybind11::init<
+              std::string_view,
+              std::string_view,
+              std::string_view,
+              std::vector<roq::python::codec::fix::MDFull>>(),
+          pybind11::arg("md_req_id") = std::string_view{},
+          pybind11::arg("symbol"),
+          pybind11::arg("security_exchange"),
+          pybind11::arg("no_md_entries"))
+      .def(
+          pybind11::init([](std::string_view const &md_req_id,
+                            std::string_view const &symbol,
+                            std::string_view const &security_exchange,
+                            pybind11::dict const &no_md_entries) {
+            return std::make_unique<value_type>(
+                md_req_id,
+                symbol,
+                security_exchange,
+                roq::python::codec::fix::from_columns<roq::python::codec::fix::MDFull>(no_md_entries));
+          }),
+          pybind11::arg("md_req_id") = std::string_view{},
+          pybind11::arg("symbol"),
+          pybind11::arg("security_exchange"),
+          pybind11::arg("no_md_entries"),
+          "Create from columns, i.e. {field: array}")
       .def_property_readonly(
           "md_req_id", [](value_type const &self) { return static_cast<value_type::value_type>(self).md_req_id; })
       .def_property_readonly(
@@ -595,9 +907,9 @@ void utils::create_ref_struct_2<
           [](value_type const &self) { return static_cast<value_type::value_type>(self).security_exchange; })
       .def_property_readonly(
           "no_md_entries",
-          [](value_type const &self) {
-            return self.no_md_entries_;  // XXX FIXME
-          })
+          utils::create_view_getter([](value_type const &self) {
+            return roq::python::codec::fix::Group<roq::python::codec::fix::MDFull>{self.no_md_entries()};
+          }))
       .def("__repr__", [](value_type const &self) {
         return fmt::format("{}"sv, static_cast<value_type::value_type>(self));
       });
@@ -611,13 +923,25 @@ void utils::create_ref_struct_2<
   using base_type = roq::python::codec::fix::Encodeable;
   std::string name{nameof::nameof_short_type<value_type>()};
   pybind11::class_<value_type, base_type>(module, name.c_str())
+      .def(
+          pybind11::init<std::string_view, std::vector<roq::python::codec::fix::MDInc>>(),
+          pybind11::arg("md_req_id") = std::string_view{},
+          pybind11::arg("no_md_entries"))
+      .def(
+          pybind11::init([](std::string_view const &md_req_id, pybind11::dict const &no_md_entries) {
+            return std::make_unique<value_type>(
+                md_req_id, roq::python::codec::fix::from_columns<roq::python::codec::fix::MDInc>(no_md_entries));
+          }),
+          pybind11::arg("md_req_id") = std::string_view{},
+          pybind11::arg("no_md_entries"),
+          "Create from columns, i.e. {field: array}")
       .def_property_readonly(
           "md_req_id", [](value_type const &self) { return static_cast<value_type::value_type>(self).md_req_id; })
       .def_property_readonly(
           "no_md_entries",
-          [](value_type const &self) {
-            return self.no_md_entries_;  // XXX FIXME
-          })
+          utils::create_view_getter([](value_type const &self) {
+            return roq::python::codec::fix::Group<roq::python::codec::fix::MDInc>{self.no_md_entries()};
+          }))
       .def("__repr__", [](value_type const &self) {
         return fmt::format("{}"sv, static_cast<value_type::value_type>(self));
       });
@@ -988,6 +1312,11 @@ void utils::create_ref_struct_2<roq::python::codec::fix::ExecutionReport, roq::p
       .def_property_readonly(
           "transact_time",
           [](value_type const &self) { return static_cast<value_type::value_type>(self).transact_time; })
+      .def_property_readonly(
+          "transact_time_ns",
+          [](value_type const &self) {
+            return utils::to_nanoseconds(static_cast<value_type::value_type>(self).transact_time);
+          })
       .def_property_readonly(
           "position_effect",
           [](value_type const &self) { return static_cast<value_type::value_type>(self).position_effect; })
@@ -1074,9 +1403,19 @@ void utils::create_ref_struct_2<roq::python::codec::fix::TradeCaptureReport, roq
           "last_px", [](value_type const &self) { return static_cast<value_type::value_type>(self).last_px.value; })
       .def_property_readonly(
           "trade_date", [](value_type const &self) { return static_cast<value_type::value_type>(self).trade_date; })
+      .def_property_readonly(
+          "trade_date_ns",
+          [](value_type const &self) {
+            return utils::to_nanoseconds(static_cast<value_type::value_type>(self).trade_date);
+          })
       .def_property_readonly(
           "transact_time",
           [](value_type const &self) { return static_cast<value_type::value_type>(self).transact_time; })
+      .def_property_readonly(
+          "transact_time_ns",
+          [](value_type const &self) {
+            return utils::to_nanoseconds(static_cast<value_type::value_type>(self).transact_time);
+          })
       .def("__repr__", [](value_type const &self) {
         return fmt::format("{}"sv, static_cast<value_type::value_type>(self));
       });
@@ -1180,6 +1519,11 @@ void utils::create_ref_struct_2<roq::python::codec::fix::PositionReport, roq::py
       .def_property_readonly(
           "clearing_business_date",
           [](value_type const &self) { return static_cast<value_type::value_type>(self).clearing_business_date; })
+      .def_property_readonly(
+          "clearing_business_date_ns",
+          [](value_type const &self) {
+            return utils::to_nanoseconds(static_cast<value_type::value_type>(self).clearing_business_date);
+          })
       .def_property_readonly(
           "account", [](value_type const &self) { return static_cast<value_type::value_type>(self).account; })
       .def_property_readonly(
@@ -1211,9 +1555,27 @@ template <>
 void utils::create_struct<roq::python::codec::fix::Header>(pybind11::module_ &module) {
   using value_type = roq::python::codec::fix::Header;
   std::string name{nameof::nameof_short_type<value_type>()};
-  pybind11::class_<value_type>(module, name.c_str()).def("__repr__", [](value_type const &self) {
-    return fmt::format("{}"sv, static_cast<value_type::value_type>(self));
-  });
+  pybind11::class_<value_type>(module, name.c_str())
+      .def_property_readonly(
+          "msg_type", [](value_type const &self) { return static_cast<value_type::value_type>(self).msg_type; })
+      .def_property_readonly(
+          "sender_comp_id",
+          [](value_type const &self) { return static_cast<value_type::value_type>(self).sender_comp_id; })
+      .def_property_readonly(
+          "target_comp_id",
+          [](value_type const &self) { return static_cast<value_type::value_type>(self).target_comp_id; })
+      .def_property_readonly(
+          "msg_seq_num", [](value_type const &self) { return static_cast<value_type::value_type>(self).msg_seq_num; })
+      .def_property_readonly(
+          "sending_time", [](value_type const &self) { return static_cast<value_type::value_type>(self).sending_time; })
+      .def_property_readonly(
+          "sending_time_ns",
+          [](value_type const &self) {
+            return utils::to_nanoseconds(static_cast<value_type::value_type>(self).sending_time);
+          })
+      .def("__repr__", [](value_type const &self) {
+        return fmt::format("{}"sv, static_cast<value_type::value_type>(self));
+      });
 }
 
 template <>
@@ -1221,7 +1583,11 @@ void utils::create_struct<roq::python::codec::fix::Decoder>(pybind11::module_ &m
   using value_type = roq::python::codec::fix::Decoder;
   std::string name{nameof::nameof_short_type<value_type>()};
   pybind11::class_<value_type>(module, name.c_str())
-      .def(pybind11::init<>())
+      .def(
+          pybind11::init<bool, std::vector<roq::fix::MsgType> const &, size_t>(),
+          pybind11::arg("view") = false,
+          pybind11::arg("msg_types") = std::vector<roq::fix::MsgType>{},
+          pybind11::arg("maximum_message_size") = value_type::MAXIMUM_MESSAGE_SIZE)
       // note! the callback signature **MUST** be pybind11::object so we can verify the reference count hasn't increased
       .def(
           "dispatch",
@@ -1229,7 +1595,1498 @@ void utils::create_struct<roq::python::codec::fix::Decoder>(pybind11::module_ &m
              std::function<void(pybind11::object, pybind11::object)> &callback,
              pybind11::bytes message) { return self.dispatch(callback, message); },
           pybind11::arg("callback"),
-          pybind11::arg("message"));
+          pybind11::arg("message"))
+      .def(
+          "feed",
+          [](value_type &self,
+             std::function<void(pybind11::object, pybind11::object)> &callback,
+             pybind11::buffer buffer) {
+            auto info = buffer.request();
+            if (info.itemsize != 1 || info.ndim != 1 || info.strides[0] != 1) {
+              using namespace std::literals;
+              throw std::invalid_argument{"Expected a contiguous byte buffer"s};
+            }
+            std::span message{static_cast<std::byte const *>(info.ptr), static_cast<size_t>(info.size)};
+            return self.feed(callback, message);
+          },
+          pybind11::arg("callback"),
+          pybind11::arg("buffer"),
+          "Decode all complete messages (any buffer-protocol object), returns number of bytes consumed")
+      .def_property_readonly("pending", [](value_type const &self) { return self.pending(); })
+      .def_property_readonly("skipped", [](value_type const &self) { return self.skipped(); })
+      .def("reset", [](value_type &self) { self.reset(); });
+}
+
+// views (decoder)
+
+template <>
+void utils::create_ref_struct<roq::fix::Header>(pybind11::module_ &module) {
+  using value_type = roq::fix::Header;
+  using ref_type = utils::Ref<value_type>;
+  using copy_type = roq::python::codec::fix::Header;
+  std::string name{nameof::nameof_short_type<value_type>()};
+  name += "Ref"sv;
+  pybind11::class_<ref_type>(module, name.c_str())
+      .def_property_readonly(
+          "msg_type",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return value.msg_type;
+          })
+      .def_property_readonly(
+          "sender_comp_id",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return value.sender_comp_id;
+          })
+      .def_property_readonly(
+          "target_comp_id",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return value.target_comp_id;
+          })
+      .def_property_readonly(
+          "msg_seq_num",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return value.msg_seq_num;
+          })
+      .def_property_readonly(
+          "sending_time",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return value.sending_time;
+          })
+      .def_property_readonly(
+          "sending_time_ns",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return utils::to_nanoseconds(value.sending_time);
+          })
+      .def(
+          "copy",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return copy_type{value};
+          },
+          "Materialize an owned copy")
+      .def("__repr__", [](ref_type const &obj) {
+        auto &value = static_cast<value_type const &>(obj);
+        return fmt::format("{}"sv, value);
+      });
+}
+
+template <>
+void utils::create_ref_struct<roq::codec::fix::Logon>(pybind11::module_ &module) {
+  using value_type = roq::codec::fix::Logon;
+  using ref_type = utils::Ref<value_type>;
+  using copy_type = roq::python::codec::fix::Logon;
+  std::string name{nameof::nameof_short_type<value_type>()};
+  name += "Ref"sv;
+  pybind11::class_<ref_type>(module, name.c_str())
+      .def(
+          "copy",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return copy_type{value};
+          },
+          "Materialize an owned copy")
+      .def("__repr__", [](ref_type const &obj) {
+        auto &value = static_cast<value_type const &>(obj);
+        return fmt::format("{}"sv, value);
+      });
+}
+
+template <>
+void utils::create_ref_struct<roq::codec::fix::Logout>(pybind11::module_ &module) {
+  using value_type = roq::codec::fix::Logout;
+  using ref_type = utils::Ref<value_type>;
+  using copy_type = roq::python::codec::fix::Logout;
+  std::string name{nameof::nameof_short_type<value_type>()};
+  name += "Ref"sv;
+  pybind11::class_<ref_type>(module, name.c_str())
+      .def(
+          "copy",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return copy_type{value};
+          },
+          "Materialize an owned copy")
+      .def("__repr__", [](ref_type const &obj) {
+        auto &value = static_cast<value_type const &>(obj);
+        return fmt::format("{}"sv, value);
+      });
+}
+
+template <>
+void utils::create_ref_struct<roq::codec::fix::TestRequest>(pybind11::module_ &module) {
+  using value_type = roq::codec::fix::TestRequest;
+  using ref_type = utils::Ref<value_type>;
+  using copy_type = roq::python::codec::fix::TestRequest;
+  std::string name{nameof::nameof_short_type<value_type>()};
+  name += "Ref"sv;
+  pybind11::class_<ref_type>(module, name.c_str())
+      .def_property_readonly(
+          "test_req_id",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return value.test_req_id;
+          })
+      .def(
+          "copy",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return copy_type{value};
+          },
+          "Materialize an owned copy")
+      .def("__repr__", [](ref_type const &obj) {
+        auto &value = static_cast<value_type const &>(obj);
+        return fmt::format("{}"sv, value);
+      });
+}
+
+template <>
+void utils::create_ref_struct<roq::codec::fix::Heartbeat>(pybind11::module_ &module) {
+  using value_type = roq::codec::fix::Heartbeat;
+  using ref_type = utils::Ref<value_type>;
+  using copy_type = roq::python::codec::fix::Heartbeat;
+  std::string name{nameof::nameof_short_type<value_type>()};
+  name += "Ref"sv;
+  pybind11::class_<ref_type>(module, name.c_str())
+      .def(
+          "copy",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return copy_type{value};
+          },
+          "Materialize an owned copy")
+      .def("__repr__", [](ref_type const &obj) {
+        auto &value = static_cast<value_type const &>(obj);
+        return fmt::format("{}"sv, value);
+      });
+}
+
+template <>
+void utils::create_ref_struct<roq::codec::fix::ResendRequest>(pybind11::module_ &module) {
+  using value_type = roq::codec::fix::ResendRequest;
+  using ref_type = utils::Ref<value_type>;
+  using copy_type = roq::python::codec::fix::ResendRequest;
+  std::string name{nameof::nameof_short_type<value_type>()};
+  name += "Ref"sv;
+  pybind11::class_<ref_type>(module, name.c_str())
+      .def(
+          "copy",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return copy_type{value};
+          },
+          "Materialize an owned copy")
+      .def("__repr__", [](ref_type const &obj) {
+        auto &value = static_cast<value_type const &>(obj);
+        return fmt::format("{}"sv, value);
+      });
+}
+
+template <>
+void utils::create_ref_struct<roq::codec::fix::Reject>(pybind11::module_ &module) {
+  using value_type = roq::codec::fix::Reject;
+  using ref_type = utils::Ref<value_type>;
+  using copy_type = roq::python::codec::fix::Reject;
+  std::string name{nameof::nameof_short_type<value_type>()};
+  name += "Ref"sv;
+  pybind11::class_<ref_type>(module, name.c_str())
+      .def(
+          "copy",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return copy_type{value};
+          },
+          "Materialize an owned copy")
+      .def("__repr__", [](ref_type const &obj) {
+        auto &value = static_cast<value_type const &>(obj);
+        return fmt::format("{}"sv, value);
+      });
+}
+
+template <>
+void utils::create_ref_struct<roq::codec::fix::BusinessMessageReject>(pybind11::module_ &module) {
+  using value_type = roq::codec::fix::BusinessMessageReject;
+  using ref_type = utils::Ref<value_type>;
+  using copy_type = roq::python::codec::fix::BusinessMessageReject;
+  std::string name{nameof::nameof_short_type<value_type>()};
+  name += "Ref"sv;
+  pybind11::class_<ref_type>(module, name.c_str())
+      .def(
+          "copy",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return copy_type{value};
+          },
+          "Materialize an owned copy")
+      .def("__repr__", [](ref_type const &obj) {
+        auto &value = static_cast<value_type const &>(obj);
+        return fmt::format("{}"sv, value);
+      });
+}
+
+template <>
+void utils::create_ref_struct<roq::codec::fix::UserRequest>(pybind11::module_ &module) {
+  using value_type = roq::codec::fix::UserRequest;
+  using ref_type = utils::Ref<value_type>;
+  using copy_type = roq::python::codec::fix::UserRequest;
+  std::string name{nameof::nameof_short_type<value_type>()};
+  name += "Ref"sv;
+  pybind11::class_<ref_type>(module, name.c_str())
+      .def(
+          "copy",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return copy_type{value};
+          },
+          "Materialize an owned copy")
+      .def("__repr__", [](ref_type const &obj) {
+        auto &value = static_cast<value_type const &>(obj);
+        return fmt::format("{}"sv, value);
+      });
+}
+
+template <>
+void utils::create_ref_struct<roq::codec::fix::UserResponse>(pybind11::module_ &module) {
+  using value_type = roq::codec::fix::UserResponse;
+  using ref_type = utils::Ref<value_type>;
+  using copy_type = roq::python::codec::fix::UserResponse;
+  std::string name{nameof::nameof_short_type<value_type>()};
+  name += "Ref"sv;
+  pybind11::class_<ref_type>(module, name.c_str())
+      .def(
+          "copy",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return copy_type{value};
+          },
+          "Materialize an owned copy")
+      .def("__repr__", [](ref_type const &obj) {
+        auto &value = static_cast<value_type const &>(obj);
+        return fmt::format("{}"sv, value);
+      });
+}
+
+template <>
+void utils::create_ref_struct<roq::codec::fix::TradingSessionStatusRequest>(pybind11::module_ &module) {
+  using value_type = roq::codec::fix::TradingSessionStatusRequest;
+  using ref_type = utils::Ref<value_type>;
+  using copy_type = roq::python::codec::fix::TradingSessionStatusRequest;
+  std::string name{nameof::nameof_short_type<value_type>()};
+  name += "Ref"sv;
+  pybind11::class_<ref_type>(module, name.c_str())
+      .def(
+          "copy",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return copy_type{value};
+          },
+          "Materialize an owned copy")
+      .def("__repr__", [](ref_type const &obj) {
+        auto &value = static_cast<value_type const &>(obj);
+        return fmt::format("{}"sv, value);
+      });
+}
+
+template <>
+void utils::create_ref_struct<roq::codec::fix::TradingSessionStatus>(pybind11::module_ &module) {
+  using value_type = roq::codec::fix::TradingSessionStatus;
+  using ref_type = utils::Ref<value_type>;
+  using copy_type = roq::python::codec::fix::TradingSessionStatus;
+  std::string name{nameof::nameof_short_type<value_type>()};
+  name += "Ref"sv;
+  pybind11::class_<ref_type>(module, name.c_str())
+      .def(
+          "copy",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return copy_type{value};
+          },
+          "Materialize an owned copy")
+      .def("__repr__", [](ref_type const &obj) {
+        auto &value = static_cast<value_type const &>(obj);
+        return fmt::format("{}"sv, value);
+      });
+}
+
+template <>
+void utils::create_ref_struct<roq::codec::fix::SecurityListRequest>(pybind11::module_ &module) {
+  using value_type = roq::codec::fix::SecurityListRequest;
+  using ref_type = utils::Ref<value_type>;
+  using copy_type = roq::python::codec::fix::SecurityListRequest;
+  std::string name{nameof::nameof_short_type<value_type>()};
+  name += "Ref"sv;
+  pybind11::class_<ref_type>(module, name.c_str())
+      .def(
+          "copy",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return copy_type{value};
+          },
+          "Materialize an owned copy")
+      .def("__repr__", [](ref_type const &obj) {
+        auto &value = static_cast<value_type const &>(obj);
+        return fmt::format("{}"sv, value);
+      });
+}
+
+template <>
+void utils::create_ref_struct<roq::codec::fix::SecurityList>(pybind11::module_ &module) {
+  using value_type = roq::codec::fix::SecurityList;
+  using ref_type = utils::Ref<value_type>;
+  using copy_type = roq::python::codec::fix::SecurityList;
+  std::string name{nameof::nameof_short_type<value_type>()};
+  name += "Ref"sv;
+  pybind11::class_<ref_type>(module, name.c_str())
+      .def_property_readonly(
+          "no_related_sym",
+          utils::create_view_getter([](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return roq::python::codec::fix::Group<roq::python::codec::fix::SecListGrp>{value.no_related_sym};
+          }))
+      .def(
+          "copy",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return copy_type{value};
+          },
+          "Materialize an owned copy")
+      .def("__repr__", [](ref_type const &obj) {
+        auto &value = static_cast<value_type const &>(obj);
+        return fmt::format("{}"sv, value);
+      });
+}
+
+template <>
+void utils::create_ref_struct<roq::codec::fix::SecurityDefinitionRequest>(pybind11::module_ &module) {
+  using value_type = roq::codec::fix::SecurityDefinitionRequest;
+  using ref_type = utils::Ref<value_type>;
+  using copy_type = roq::python::codec::fix::SecurityDefinitionRequest;
+  std::string name{nameof::nameof_short_type<value_type>()};
+  name += "Ref"sv;
+  pybind11::class_<ref_type>(module, name.c_str())
+      .def(
+          "copy",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return copy_type{value};
+          },
+          "Materialize an owned copy")
+      .def("__repr__", [](ref_type const &obj) {
+        auto &value = static_cast<value_type const &>(obj);
+        return fmt::format("{}"sv, value);
+      });
+}
+
+template <>
+void utils::create_ref_struct<roq::codec::fix::SecurityDefinition>(pybind11::module_ &module) {
+  using value_type = roq::codec::fix::SecurityDefinition;
+  using ref_type = utils::Ref<value_type>;
+  using copy_type = roq::python::codec::fix::SecurityDefinition;
+  std::string name{nameof::nameof_short_type<value_type>()};
+  name += "Ref"sv;
+  pybind11::class_<ref_type>(module, name.c_str())
+      .def(
+          "copy",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return copy_type{value};
+          },
+          "Materialize an owned copy")
+      .def("__repr__", [](ref_type const &obj) {
+        auto &value = static_cast<value_type const &>(obj);
+        return fmt::format("{}"sv, value);
+      });
+}
+
+template <>
+void utils::create_ref_struct<roq::codec::fix::SecurityStatusRequest>(pybind11::module_ &module) {
+  using value_type = roq::codec::fix::SecurityStatusRequest;
+  using ref_type = utils::Ref<value_type>;
+  using copy_type = roq::python::codec::fix::SecurityStatusRequest;
+  std::string name{nameof::nameof_short_type<value_type>()};
+  name += "Ref"sv;
+  pybind11::class_<ref_type>(module, name.c_str())
+      .def(
+          "copy",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return copy_type{value};
+          },
+          "Materialize an owned copy")
+      .def("__repr__", [](ref_type const &obj) {
+        auto &value = static_cast<value_type const &>(obj);
+        return fmt::format("{}"sv, value);
+      });
+}
+
+template <>
+void utils::create_ref_struct<roq::codec::fix::SecurityStatus>(pybind11::module_ &module) {
+  using value_type = roq::codec::fix::SecurityStatus;
+  using ref_type = utils::Ref<value_type>;
+  using copy_type = roq::python::codec::fix::SecurityStatus;
+  std::string name{nameof::nameof_short_type<value_type>()};
+  name += "Ref"sv;
+  pybind11::class_<ref_type>(module, name.c_str())
+      .def(
+          "copy",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return copy_type{value};
+          },
+          "Materialize an owned copy")
+      .def("__repr__", [](ref_type const &obj) {
+        auto &value = static_cast<value_type const &>(obj);
+        return fmt::format("{}"sv, value);
+      });
+}
+
+template <>
+void utils::create_ref_struct<roq::codec::fix::MarketDataRequest>(pybind11::module_ &module) {
+  using value_type = roq::codec::fix::MarketDataRequest;
+  using ref_type = utils::Ref<value_type>;
+  using copy_type = roq::python::codec::fix::MarketDataRequest;
+  std::string name{nameof::nameof_short_type<value_type>()};
+  name += "Ref"sv;
+  pybind11::class_<ref_type>(module, name.c_str())
+      .def_property_readonly(
+          "no_related_sym",
+          utils::create_view_getter([](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return roq::python::codec::fix::Group<roq::python::codec::fix::InstrmtMDReq>{value.no_related_sym};
+          }))
+      .def(
+          "copy",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return copy_type{value};
+          },
+          "Materialize an owned copy")
+      .def("__repr__", [](ref_type const &obj) {
+        auto &value = static_cast<value_type const &>(obj);
+        return fmt::format("{}"sv, value);
+      });
+}
+
+template <>
+void utils::create_ref_struct<roq::codec::fix::MarketDataRequestReject>(pybind11::module_ &module) {
+  using value_type = roq::codec::fix::MarketDataRequestReject;
+  using ref_type = utils::Ref<value_type>;
+  using copy_type = roq::python::codec::fix::MarketDataRequestReject;
+  std::string name{nameof::nameof_short_type<value_type>()};
+  name += "Ref"sv;
+  pybind11::class_<ref_type>(module, name.c_str())
+      .def_property_readonly(
+          "md_req_id",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return value.md_req_id;
+          })
+      .def_property_readonly(
+          "md_req_rej_reason",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return value.md_req_rej_reason;
+          })
+      .def_property_readonly(
+          "text",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return value.text;
+          })
+      .def(
+          "copy",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return copy_type{value};
+          },
+          "Materialize an owned copy")
+      .def("__repr__", [](ref_type const &obj) {
+        auto &value = static_cast<value_type const &>(obj);
+        return fmt::format("{}"sv, value);
+      });
+}
+
+template <>
+void utils::create_ref_struct<roq::codec::fix::MarketDataSnapshotFullRefresh>(pybind11::module_ &module) {
+  using value_type = roq::codec::fix::MarketDataSnapshotFullRefresh;
+  using ref_type = utils::Ref<value_type>;
+  using copy_type = roq::python::codec::fix::MarketDataSnapshotFullRefresh;
+  std::string name{nameof::nameof_short_type<value_type>()};
+  name += "Ref"sv;
+  pybind11::class_<ref_type>(module, name.c_str())
+      .def_property_readonly(
+          "md_req_id",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return value.md_req_id;
+          })
+      .def_property_readonly(
+          "symbol",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return value.symbol;
+          })
+      .def_property_readonly(
+          "security_exchange",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return value.security_exchange;
+          })
+      .def_property_readonly(
+          "no_md_entries",
+          utils::create_view_getter([](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return roq::python::codec::fix::Group<roq::python::codec::fix::MDFull>{value.no_md_entries};
+          }))
+      .def(
+          "copy",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return copy_type{value};
+          },
+          "Materialize an owned copy")
+      .def("__repr__", [](ref_type const &obj) {
+        auto &value = static_cast<value_type const &>(obj);
+        return fmt::format("{}"sv, value);
+      });
+}
+
+template <>
+void utils::create_ref_struct<roq::codec::fix::MarketDataIncrementalRefresh>(pybind11::module_ &module) {
+  using value_type = roq::codec::fix::MarketDataIncrementalRefresh;
+  using ref_type = utils::Ref<value_type>;
+  using copy_type = roq::python::codec::fix::MarketDataIncrementalRefresh;
+  std::string name{nameof::nameof_short_type<value_type>()};
+  name += "Ref"sv;
+  pybind11::class_<ref_type>(module, name.c_str())
+      .def_property_readonly(
+          "md_req_id",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return value.md_req_id;
+          })
+      .def_property_readonly(
+          "no_md_entries",
+          utils::create_view_getter([](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return roq::python::codec::fix::Group<roq::python::codec::fix::MDInc>{value.no_md_entries};
+          }))
+      .def(
+          "copy",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return copy_type{value};
+          },
+          "Materialize an owned copy")
+      .def("__repr__", [](ref_type const &obj) {
+        auto &value = static_cast<value_type const &>(obj);
+        return fmt::format("{}"sv, value);
+      });
+}
+
+template <>
+void utils::create_ref_struct<roq::codec::fix::OrderStatusRequest>(pybind11::module_ &module) {
+  using value_type = roq::codec::fix::OrderStatusRequest;
+  using ref_type = utils::Ref<value_type>;
+  using copy_type = roq::python::codec::fix::OrderStatusRequest;
+  std::string name{nameof::nameof_short_type<value_type>()};
+  name += "Ref"sv;
+  pybind11::class_<ref_type>(module, name.c_str())
+      .def(
+          "copy",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return copy_type{value};
+          },
+          "Materialize an owned copy")
+      .def("__repr__", [](ref_type const &obj) {
+        auto &value = static_cast<value_type const &>(obj);
+        return fmt::format("{}"sv, value);
+      });
+}
+
+template <>
+void utils::create_ref_struct<roq::codec::fix::OrderMassStatusRequest>(pybind11::module_ &module) {
+  using value_type = roq::codec::fix::OrderMassStatusRequest;
+  using ref_type = utils::Ref<value_type>;
+  using copy_type = roq::python::codec::fix::OrderMassStatusRequest;
+  std::string name{nameof::nameof_short_type<value_type>()};
+  name += "Ref"sv;
+  pybind11::class_<ref_type>(module, name.c_str())
+      .def(
+          "copy",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return copy_type{value};
+          },
+          "Materialize an owned copy")
+      .def("__repr__", [](ref_type const &obj) {
+        auto &value = static_cast<value_type const &>(obj);
+        return fmt::format("{}"sv, value);
+      });
+}
+
+template <>
+void utils::create_ref_struct<roq::codec::fix::NewOrderSingle>(pybind11::module_ &module) {
+  using value_type = roq::codec::fix::NewOrderSingle;
+  using ref_type = utils::Ref<value_type>;
+  using copy_type = roq::python::codec::fix::NewOrderSingle;
+  std::string name{nameof::nameof_short_type<value_type>()};
+  name += "Ref"sv;
+  pybind11::class_<ref_type>(module, name.c_str())
+      .def(
+          "copy",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return copy_type{value};
+          },
+          "Materialize an owned copy")
+      .def("__repr__", [](ref_type const &obj) {
+        auto &value = static_cast<value_type const &>(obj);
+        return fmt::format("{}"sv, value);
+      });
+}
+
+template <>
+void utils::create_ref_struct<roq::codec::fix::OrderCancelRequest>(pybind11::module_ &module) {
+  using value_type = roq::codec::fix::OrderCancelRequest;
+  using ref_type = utils::Ref<value_type>;
+  using copy_type = roq::python::codec::fix::OrderCancelRequest;
+  std::string name{nameof::nameof_short_type<value_type>()};
+  name += "Ref"sv;
+  pybind11::class_<ref_type>(module, name.c_str())
+      .def(
+          "copy",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return copy_type{value};
+          },
+          "Materialize an owned copy")
+      .def("__repr__", [](ref_type const &obj) {
+        auto &value = static_cast<value_type const &>(obj);
+        return fmt::format("{}"sv, value);
+      });
+}
+
+template <>
+void utils::create_ref_struct<roq::codec::fix::OrderCancelReplaceRequest>(pybind11::module_ &module) {
+  using value_type = roq::codec::fix::OrderCancelReplaceRequest;
+  using ref_type = utils::Ref<value_type>;
+  using copy_type = roq::python::codec::fix::OrderCancelReplaceRequest;
+  std::string name{nameof::nameof_short_type<value_type>()};
+  name += "Ref"sv;
+  pybind11::class_<ref_type>(module, name.c_str())
+      .def(
+          "copy",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return copy_type{value};
+          },
+          "Materialize an owned copy")
+      .def("__repr__", [](ref_type const &obj) {
+        auto &value = static_cast<value_type const &>(obj);
+        return fmt::format("{}"sv, value);
+      });
+}
+
+template <>
+void utils::create_ref_struct<roq::codec::fix::OrderMassCancelRequest>(pybind11::module_ &module) {
+  using value_type = roq::codec::fix::OrderMassCancelRequest;
+  using ref_type = utils::Ref<value_type>;
+  using copy_type = roq::python::codec::fix::OrderMassCancelRequest;
+  std::string name{nameof::nameof_short_type<value_type>()};
+  name += "Ref"sv;
+  pybind11::class_<ref_type>(module, name.c_str())
+      .def(
+          "copy",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return copy_type{value};
+          },
+          "Materialize an owned copy")
+      .def("__repr__", [](ref_type const &obj) {
+        auto &value = static_cast<value_type const &>(obj);
+        return fmt::format("{}"sv, value);
+      });
+}
+
+template <>
+void utils::create_ref_struct<roq::codec::fix::OrderCancelReject>(pybind11::module_ &module) {
+  using value_type = roq::codec::fix::OrderCancelReject;
+  using ref_type = utils::Ref<value_type>;
+  using copy_type = roq::python::codec::fix::OrderCancelReject;
+  std::string name{nameof::nameof_short_type<value_type>()};
+  name += "Ref"sv;
+  pybind11::class_<ref_type>(module, name.c_str())
+      .def_property_readonly(
+          "order_id",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return value.order_id;
+          })
+      .def_property_readonly(
+          "secondary_cl_ord_id",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return value.secondary_cl_ord_id;
+          })
+      .def_property_readonly(
+          "cl_ord_id",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return value.cl_ord_id;
+          })
+      .def_property_readonly(
+          "orig_cl_ord_id",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return value.orig_cl_ord_id;
+          })
+      .def_property_readonly(
+          "ord_status",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return value.ord_status;
+          })
+      .def_property_readonly(
+          "working_indicator",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return value.working_indicator;
+          })
+      .def_property_readonly(
+          "account",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return value.account;
+          })
+      .def_property_readonly(
+          "cxl_rej_response_to",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return value.cxl_rej_response_to;
+          })
+      .def_property_readonly(
+          "cxl_rej_reason",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return value.cxl_rej_reason;
+          })
+      .def_property_readonly(
+          "text",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return value.text;
+          })
+      .def(
+          "copy",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return copy_type{value};
+          },
+          "Materialize an owned copy")
+      .def("__repr__", [](ref_type const &obj) {
+        auto &value = static_cast<value_type const &>(obj);
+        return fmt::format("{}"sv, value);
+      });
+}
+
+template <>
+void utils::create_ref_struct<roq::codec::fix::OrderMassCancelReport>(pybind11::module_ &module) {
+  using value_type = roq::codec::fix::OrderMassCancelReport;
+  using ref_type = utils::Ref<value_type>;
+  using copy_type = roq::python::codec::fix::OrderMassCancelReport;
+  std::string name{nameof::nameof_short_type<value_type>()};
+  name += "Ref"sv;
+  pybind11::class_<ref_type>(module, name.c_str())
+      .def_property_readonly(
+          "cl_ord_id",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return value.cl_ord_id;
+          })
+      .def_property_readonly(
+          "order_id",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return value.order_id;
+          })
+      .def_property_readonly(
+          "mass_cancel_request_type",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return value.mass_cancel_request_type;
+          })
+      .def_property_readonly(
+          "mass_cancel_response",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return value.mass_cancel_response;
+          })
+      .def_property_readonly(
+          "mass_cancel_reject_reason",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return value.mass_cancel_reject_reason;
+          })
+      .def_property_readonly(
+          "total_affected_orders",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return value.total_affected_orders;
+          })
+      .def_property_readonly(
+          "symbol",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return value.symbol;
+          })
+      .def_property_readonly(
+          "security_exchange",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return value.security_exchange;
+          })
+      .def_property_readonly(
+          "side",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return value.side;
+          })
+      .def_property_readonly(
+          "text",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return value.text;
+          })
+      .def(
+          "copy",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return copy_type{value};
+          },
+          "Materialize an owned copy")
+      .def("__repr__", [](ref_type const &obj) {
+        auto &value = static_cast<value_type const &>(obj);
+        return fmt::format("{}"sv, value);
+      });
+}
+
+template <>
+void utils::create_ref_struct<roq::codec::fix::ExecutionReport>(pybind11::module_ &module) {
+  using value_type = roq::codec::fix::ExecutionReport;
+  using ref_type = utils::Ref<value_type>;
+  using copy_type = roq::python::codec::fix::ExecutionReport;
+  std::string name{nameof::nameof_short_type<value_type>()};
+  name += "Ref"sv;
+  pybind11::class_<ref_type>(module, name.c_str())
+      .def_property_readonly(
+          "order_id",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return value.order_id;
+          })
+      .def_property_readonly(
+          "secondary_cl_ord_id",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return value.secondary_cl_ord_id;
+          })
+      .def_property_readonly(
+          "cl_ord_id",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return value.cl_ord_id;
+          })
+      .def_property_readonly(
+          "orig_cl_ord_id",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return value.orig_cl_ord_id;
+          })
+      .def_property_readonly(
+          "ord_status_req_id",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return value.ord_status_req_id;
+          })
+      .def_property_readonly(
+          "mass_status_req_id",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return value.mass_status_req_id;
+          })
+      .def_property_readonly(
+          "tot_num_reports",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return value.tot_num_reports;
+          })
+      .def_property_readonly(
+          "last_rpt_requested",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return value.last_rpt_requested;
+          })
+      .def_property_readonly(
+          "exec_id",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return value.exec_id;
+          })
+      .def_property_readonly(
+          "exec_type",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return value.exec_type;
+          })
+      .def_property_readonly(
+          "ord_status",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return value.ord_status;
+          })
+      .def_property_readonly(
+          "working_indicator",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return value.working_indicator;
+          })
+      .def_property_readonly(
+          "ord_rej_reason",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return value.ord_rej_reason;
+          })
+      .def_property_readonly(
+          "account",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return value.account;
+          })
+      .def_property_readonly(
+          "account_type",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return value.account_type;
+          })
+      .def_property_readonly(
+          "symbol",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return value.symbol;
+          })
+      .def_property_readonly(
+          "security_exchange",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return value.security_exchange;
+          })
+      .def_property_readonly(
+          "side",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return value.side;
+          })
+      .def_property_readonly(
+          "ord_type",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return value.ord_type;
+          })
+      .def_property_readonly(
+          "order_qty",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return value.order_qty.value;
+          })
+      .def_property_readonly(
+          "price",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return value.price.value;
+          })
+      .def_property_readonly(
+          "stop_px",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return value.stop_px.value;
+          })
+      .def_property_readonly(
+          "currency",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return value.currency;
+          })
+      .def_property_readonly(
+          "time_in_force",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return value.time_in_force;
+          })
+      .def_property_readonly(
+          "exec_inst",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return value.exec_inst;
+          })
+      .def_property_readonly(
+          "last_qty",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return value.last_qty.value;
+          })
+      .def_property_readonly(
+          "last_px",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return value.last_px.value;
+          })
+      .def_property_readonly(
+          "trading_session_id",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return value.trading_session_id;
+          })
+      .def_property_readonly(
+          "leaves_qty",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return value.leaves_qty.value;
+          })
+      .def_property_readonly(
+          "cum_qty",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return value.cum_qty.value;
+          })
+      .def_property_readonly(
+          "avg_px",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return value.avg_px.value;
+          })
+      .def_property_readonly(
+          "transact_time",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return value.transact_time;
+          })
+      .def_property_readonly(
+          "transact_time_ns",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return utils::to_nanoseconds(value.transact_time);
+          })
+      .def_property_readonly(
+          "position_effect",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return value.position_effect;
+          })
+      .def_property_readonly(
+          "max_show",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return value.max_show;
+          })
+      .def_property_readonly(
+          "text",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return value.text;
+          })
+      .def_property_readonly(
+          "last_liquidity_ind",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return value.last_liquidity_ind;
+          })
+      .def(
+          "copy",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return copy_type{value};
+          },
+          "Materialize an owned copy")
+      .def("__repr__", [](ref_type const &obj) {
+        auto &value = static_cast<value_type const &>(obj);
+        return fmt::format("{}"sv, value);
+      });
+}
+
+template <>
+void utils::create_ref_struct<roq::codec::fix::TradeCaptureReportRequest>(pybind11::module_ &module) {
+  using value_type = roq::codec::fix::TradeCaptureReportRequest;
+  using ref_type = utils::Ref<value_type>;
+  using copy_type = roq::python::codec::fix::TradeCaptureReportRequest;
+  std::string name{nameof::nameof_short_type<value_type>()};
+  name += "Ref"sv;
+  pybind11::class_<ref_type>(module, name.c_str())
+      .def(
+          "copy",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return copy_type{value};
+          },
+          "Materialize an owned copy")
+      .def("__repr__", [](ref_type const &obj) {
+        auto &value = static_cast<value_type const &>(obj);
+        return fmt::format("{}"sv, value);
+      });
+}
+
+template <>
+void utils::create_ref_struct<roq::codec::fix::TradeCaptureReport>(pybind11::module_ &module) {
+  using value_type = roq::codec::fix::TradeCaptureReport;
+  using ref_type = utils::Ref<value_type>;
+  using copy_type = roq::python::codec::fix::TradeCaptureReport;
+  std::string name{nameof::nameof_short_type<value_type>()};
+  name += "Ref"sv;
+  pybind11::class_<ref_type>(module, name.c_str())
+      .def_property_readonly(
+          "trade_report_id",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return value.trade_report_id;
+          })
+      .def_property_readonly(
+          "trade_request_id",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return value.trade_request_id;
+          })
+      .def_property_readonly(
+          "exec_type",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return value.exec_type;
+          })
+      .def_property_readonly(
+          "tot_num_trade_reports",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return value.tot_num_trade_reports;
+          })
+      .def_property_readonly(
+          "last_rpt_requested",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return value.last_rpt_requested;
+          })
+      .def_property_readonly(
+          "unsolicited_indicator",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return value.unsolicited_indicator;
+          })
+      .def_property_readonly(
+          "trd_match_id",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return value.trd_match_id;
+          })
+      .def_property_readonly(
+          "exec_id",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return value.exec_id;
+          })
+      .def_property_readonly(
+          "previously_reported",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return value.previously_reported;
+          })
+      .def_property_readonly(
+          "symbol",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return value.symbol;
+          })
+      .def_property_readonly(
+          "security_exchange",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return value.security_exchange;
+          })
+      .def_property_readonly(
+          "last_qty",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return value.last_qty.value;
+          })
+      .def_property_readonly(
+          "last_px",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return value.last_px.value;
+          })
+      .def_property_readonly(
+          "trade_date",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return value.trade_date;
+          })
+      .def_property_readonly(
+          "trade_date_ns",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return utils::to_nanoseconds(value.trade_date);
+          })
+      .def_property_readonly(
+          "transact_time",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return value.transact_time;
+          })
+      .def_property_readonly(
+          "transact_time_ns",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return utils::to_nanoseconds(value.transact_time);
+          })
+      .def(
+          "copy",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return copy_type{value};
+          },
+          "Materialize an owned copy")
+      .def("__repr__", [](ref_type const &obj) {
+        auto &value = static_cast<value_type const &>(obj);
+        return fmt::format("{}"sv, value);
+      });
+}
+
+template <>
+void utils::create_ref_struct<roq::codec::fix::RequestForPositions>(pybind11::module_ &module) {
+  using value_type = roq::codec::fix::RequestForPositions;
+  using ref_type = utils::Ref<value_type>;
+  using copy_type = roq::python::codec::fix::RequestForPositions;
+  std::string name{nameof::nameof_short_type<value_type>()};
+  name += "Ref"sv;
+  pybind11::class_<ref_type>(module, name.c_str())
+      .def(
+          "copy",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return copy_type{value};
+          },
+          "Materialize an owned copy")
+      .def("__repr__", [](ref_type const &obj) {
+        auto &value = static_cast<value_type const &>(obj);
+        return fmt::format("{}"sv, value);
+      });
+}
+
+template <>
+void utils::create_ref_struct<roq::codec::fix::RequestForPositionsAck>(pybind11::module_ &module) {
+  using value_type = roq::codec::fix::RequestForPositionsAck;
+  using ref_type = utils::Ref<value_type>;
+  using copy_type = roq::python::codec::fix::RequestForPositionsAck;
+  std::string name{nameof::nameof_short_type<value_type>()};
+  name += "Ref"sv;
+  pybind11::class_<ref_type>(module, name.c_str())
+      .def_property_readonly(
+          "pos_maint_rpt_id",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return value.pos_maint_rpt_id;
+          })
+      .def_property_readonly(
+          "pos_req_id",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return value.pos_req_id;
+          })
+      .def_property_readonly(
+          "total_num_pos_reports",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return value.total_num_pos_reports;
+          })
+      .def_property_readonly(
+          "unsolicited_indicator",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return value.unsolicited_indicator;
+          })
+      .def_property_readonly(
+          "pos_req_result",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return value.pos_req_result;
+          })
+      .def_property_readonly(
+          "pos_req_status",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return value.pos_req_status;
+          })
+      .def_property_readonly(
+          "account",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return value.account;
+          })
+      .def_property_readonly(
+          "account_type",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return value.account_type;
+          })
+      .def_property_readonly(
+          "text",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return value.text;
+          })
+      .def(
+          "copy",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return copy_type{value};
+          },
+          "Materialize an owned copy")
+      .def("__repr__", [](ref_type const &obj) {
+        auto &value = static_cast<value_type const &>(obj);
+        return fmt::format("{}"sv, value);
+      });
+}
+
+template <>
+void utils::create_ref_struct<roq::codec::fix::PositionReport>(pybind11::module_ &module) {
+  using value_type = roq::codec::fix::PositionReport;
+  using ref_type = utils::Ref<value_type>;
+  using copy_type = roq::python::codec::fix::PositionReport;
+  std::string name{nameof::nameof_short_type<value_type>()};
+  name += "Ref"sv;
+  pybind11::class_<ref_type>(module, name.c_str())
+      .def_property_readonly(
+          "pos_maint_rpt_id",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return value.pos_maint_rpt_id;
+          })
+      .def_property_readonly(
+          "pos_req_id",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return value.pos_req_id;
+          })
+      .def_property_readonly(
+          "pos_req_type",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return value.pos_req_type;
+          })
+      .def_property_readonly(
+          "subscription_request_type",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return value.subscription_request_type;
+          })
+      .def_property_readonly(
+          "total_num_pos_reports",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return value.total_num_pos_reports;
+          })
+      .def_property_readonly(
+          "unsolicited_indicator",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return value.unsolicited_indicator;
+          })
+      .def_property_readonly(
+          "pos_req_result",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return value.pos_req_result;
+          })
+      .def_property_readonly(
+          "clearing_business_date",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return value.clearing_business_date;
+          })
+      .def_property_readonly(
+          "clearing_business_date_ns",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return utils::to_nanoseconds(value.clearing_business_date);
+          })
+      .def_property_readonly(
+          "account",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return value.account;
+          })
+      .def_property_readonly(
+          "account_type",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return value.account_type;
+          })
+      .def_property_readonly(
+          "symbol",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return value.symbol;
+          })
+      .def_property_readonly(
+          "security_exchange",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return value.security_exchange;
+          })
+      .def_property_readonly(
+          "currency",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return value.currency;
+          })
+      .def_property_readonly(
+          "settl_price",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return value.settl_price.value;
+          })
+      .def_property_readonly(
+          "settl_price_type",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return value.settl_price_type;
+          })
+      .def_property_readonly(
+          "prior_settl_price",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return value.prior_settl_price.value;
+          })
+      .def_property_readonly(
+          "text",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return value.text;
+          })
+      .def(
+          "copy",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return copy_type{value};
+          },
+          "Materialize an owned copy")
+      .def("__repr__", [](ref_type const &obj) {
+        auto &value = static_cast<value_type const &>(obj);
+        return fmt::format("{}"sv, value);
+      });
 }
 
 }  // namespace python
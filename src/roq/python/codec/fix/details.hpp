@@ -513,6 +513,12 @@ struct SecurityList final : public Encodeable {
         no_related_sym_{create<decltype(no_related_sym_)>(no_related_sym)},
         no_related_sym_2_{create_2<decltype(no_related_sym_2_)>(no_related_sym_)} {}
 
+  // note! the codec entries (_2) view the owned entries, i.e. must be rebuilt (a move falls back to this copy)
+  SecurityList(SecurityList const &other)
+      : Encodeable{other}, security_req_id_{other.security_req_id_}, security_response_id_{other.security_response_id_},
+        security_request_result_{other.security_request_result_}, no_related_sym_{other.no_related_sym_},
+        no_related_sym_2_{create_2<decltype(no_related_sym_2_)>(no_related_sym_)} {}
+
   operator value_type() const {
     return {
         .security_req_id = security_req_id_,
@@ -522,6 +528,8 @@ struct SecurityList final : public Encodeable {
     };
   }
 
+  std::span<roq::codec::fix::SecListGrp const> no_related_sym() const { return no_related_sym_2_; }
+
  protected:
   std::span<std::byte const> encode(Encoder &encoder, std::chrono::nanoseconds sending_time) const override {
     return encoder.encode(static_cast<value_type>(*this), sending_time);
@@ -821,6 +829,14 @@ struct MarketDataRequest final : public Encodeable {
   // no_trading_sessions_{no_trading_sessions}
   {}
 
+  // note! the codec entries (_2) view the owned entries, i.e. must be rebuilt (a move falls back to this copy)
+  MarketDataRequest(MarketDataRequest const &other)
+      : Encodeable{other}, md_req_id_{other.md_req_id_}, subscription_request_type_{other.subscription_request_type_},
+        market_depth_{other.market_depth_}, md_update_type_{other.md_update_type_},
+        aggregated_book_{other.aggregated_book_}, no_md_entry_types_{other.no_md_entry_types_},
+        no_related_sym_{other.no_related_sym_},
+        no_related_sym_2_{create_2<decltype(no_related_sym_2_)>(no_related_sym_)} {}
+
   operator value_type() const {
     return {
         .md_req_id = md_req_id_,
@@ -836,6 +852,8 @@ struct MarketDataRequest final : public Encodeable {
     };
   }
 
+  std::span<roq::codec::fix::InstrmtMDReq const> no_related_sym() const { return no_related_sym_2_; }
+
  protected:
   std::span<std::byte const> encode(Encoder &encoder, std::chrono::nanoseconds sending_time) const override {
     return encoder.encode(static_cast<value_type>(*this), sending_time);
@@ -994,6 +1012,21 @@ struct MarketDataSnapshotFullRefresh final : public Encodeable {
         no_md_entries_{create<decltype(no_md_entries_)>(value.no_md_entries)},
         no_md_entries_2_{create_2<decltype(no_md_entries_2_)>(no_md_entries_)} {}
 
+  MarketDataSnapshotFullRefresh(
+      std::string_view const &md_req_id,
+      std::string_view const &symbol,
+      std::string_view const &security_exchange,
+      std::vector<MDFull> const &no_md_entries)
+      : md_req_id_{md_req_id}, symbol_{symbol}, security_exchange_{security_exchange},
+        no_md_entries_{create<decltype(no_md_entries_)>(no_md_entries)},
+        no_md_entries_2_{create_2<decltype(no_md_entries_2_)>(no_md_entries_)} {}
+
+  // note! the codec entries (_2) view the owned entries, i.e. must be rebuilt (a move falls back to this copy)
+  MarketDataSnapshotFullRefresh(MarketDataSnapshotFullRefresh const &other)
+      : Encodeable{other}, md_req_id_{other.md_req_id_}, symbol_{other.symbol_},
+        security_exchange_{other.security_exchange_}, no_md_entries_{other.no_md_entries_},
+        no_md_entries_2_{create_2<decltype(no_md_entries_2_)>(no_md_entries_)} {}
+
   operator value_type() const {
     return {
         .md_req_id = md_req_id_,
@@ -1003,6 +1036,8 @@ struct MarketDataSnapshotFullRefresh final : public Encodeable {
     };
   }
 
+  std::span<roq::codec::fix::MDFull const> no_md_entries() const { return no_md_entries_2_; }
+
  protected:
   std::span<std::byte const> encode(Encoder &encoder, std::chrono::nanoseconds sending_time) const override {
     return encoder.encode(static_cast<value_type>(*this), sending_time);
@@ -1032,8 +1067,7 @@ struct MarketDataSnapshotFullRefresh final : public Encodeable {
     return result;
   }
 
-  // private:
- public:  // XXX FIXME
+ private:
   std::string const md_req_id_;
   std::string const symbol_;
   std::string const security_exchange_;
@@ -1048,6 +1082,15 @@ struct MarketDataIncrementalRefresh final : public Encodeable {
       : md_req_id_{value.md_req_id}, no_md_entries_{create<decltype(no_md_entries_)>(value.no_md_entries)},
         no_md_entries_2_{create_2<decltype(no_md_entries_2_)>(no_md_entries_)} {}
 
+  MarketDataIncrementalRefresh(std::string_view const &md_req_id, std::vector<MDInc> const &no_md_entries)
+      : md_req_id_{md_req_id}, no_md_entries_{create<decltype(no_md_entries_)>(no_md_entries)},
+        no_md_entries_2_{create_2<decltype(no_md_entries_2_)>(no_md_entries_)} {}
+
+  // note! the codec entries (_2) view the owned entries, i.e. must be rebuilt (a move falls back to this copy)
+  MarketDataIncrementalRefresh(MarketDataIncrementalRefresh const &other)
+      : Encodeable{other}, md_req_id_{other.md_req_id_}, no_md_entries_{other.no_md_entries_},
+        no_md_entries_2_{create_2<decltype(no_md_entries_2_)>(no_md_entries_)} {}
+
   operator value_type() const {
     return {
         .md_req_id = md_req_id_,
@@ -1055,6 +1098,8 @@ struct MarketDataIncrementalRefresh final : public Encodeable {
     };
   }
 
+  std::span<roq::codec::fix::MDInc const> no_md_entries() const { return no_md_entries_2_; }
+
  protected:
   std::span<std::byte const> encode(Encoder &encoder, std::chrono::nanoseconds sending_time) const override {
     return encoder.encode(static_cast<value_type>(*this), sending_time);
@@ -1084,8 +1129,7 @@ struct MarketDataIncrementalRefresh final : public Encodeable {
     return result;
   }
 
-  // private:
- public:  // XXX FIXME
+ private:
   std::string const md_req_id_;
   std::vector<MDInc> const no_md_entries_;
   std::vector<roq::codec::fix::MDInc> const no_md_entries_2_;
@@ -3,22 +3,35 @@
 #pragma once
 
 #include <chrono>
+#include <cstring>
+#include <memory>
 #include <span>
+#include <stdexcept>
 #include <string>
 #include <string_view>
+#include <vector>
 
 #include "roq/codec/fix/encoder.hpp"
 
 #include "roq/python/codec/fix/encodeable.hpp"
+#include "roq/python/codec/fix/journal.hpp"
 
 namespace roq {
 namespace python {
 namespace codec {
 namespace fix {
 
+// note! the (optional) journal records every encoded message and the sequence number is resumed from the journal
+
 struct Encoder final {
-  Encoder(std::string_view const &sender_comp_id, std::string_view const &target_comp_id)
-      : encoder_{roq::codec::fix::Encoder::create()}, sender_comp_id_{sender_comp_id}, target_comp_id_{target_comp_id} {
+  Encoder(
+      std::string_view const &sender_comp_id,
+      std::string_view const &target_comp_id,
+      std::string_view const &journal = {})
+      : encoder_{roq::codec::fix::Encoder::create()}, sender_comp_id_{sender_comp_id}, target_comp_id_{target_comp_id},
+        journal_{std::empty(journal) ? nullptr : std::make_unique<Journal>(journal)} {
+    if (journal_)
+      msg_seq_num_ = (*journal_).last_msg_seq_num();
   }
 
   template <typename T>
@@ -31,18 +44,79 @@ struct Encoder final {
         .msg_seq_num = ++msg_seq_num_,
         .sending_time = sending_time,
     };
-    return (*encoder_).encode(header, value);
+    auto message = (*encoder_).encode(header, value);
+    if (journal_)
+      (*journal_).append(header.msg_seq_num, message);
+    return message;
   }
 
   std::span<std::byte const> encode(Encodeable const &encodeable, std::chrono::system_clock::time_point sending_time) {
     return encodeable.encode(*this, sending_time.time_since_epoch());
   }
 
+  std::string_view sender_comp_id() const { return sender_comp_id_; }
+  std::string_view target_comp_id() const { return target_comp_id_; }
+
+  uint64_t msg_seq_num() const { return msg_seq_num_; }
+  uint64_t next_msg_seq_num() { return ++msg_seq_num_; }
+
+  Journal const *journal() const { return journal_.get(); }
+
+  // note! used by messages not encoded by this object
+  void append_journal(uint64_t msg_seq_num, std::span<std::byte const> const &message) {
+    if (journal_)
+      (*journal_).append(msg_seq_num, message);
+  }
+
+  // note!
+  //   the native encoder only encodes into its own buffer, the message is therefore copied (no allocation)
+  //   the sequence number is not consumed if the message doesn't fit
+  size_t encode_into(
+      Encodeable const &encodeable, std::chrono::system_clock::time_point sending_time, std::span<std::byte> buffer) {
+    auto message = encode(encodeable, sending_time);
+    if (std::size(message) > std::size(buffer)) {
+      --msg_seq_num_;
+      if (journal_)
+        (*journal_).pop_back();
+      using namespace std::literals;
+      throw std::out_of_range{"Buffer is too small"s};
+    }
+    std::memcpy(std::data(buffer), std::data(message), std::size(message));
+    return std::size(message);
+  }
+
+  // note!
+  //   messages are concatenated (the buffer is reused by the next call)
+  //   all-or-nothing, sequence numbers and journal records are rolled back if any message fails to encode
+  template <typename Range>
+  std::span<std::byte const> encode_many(Range const &range, std::chrono::system_clock::time_point sending_time) {
+    buffer_.clear();
+    auto msg_seq_num = msg_seq_num_;
+    size_t count = {};
+    try {
+      for (auto &item : range) {
+        auto message = encode(item, sending_time);
+        ++count;
+        buffer_.insert(std::end(buffer_), std::begin(message), std::end(message));
+      }
+    } catch (...) {
+      if (journal_)
+        for (size_t i = 0; i < count; ++i)
+          (*journal_).pop_back();
+      msg_seq_num_ = msg_seq_num;
+      buffer_.clear();
+      throw;
+    }
+    return buffer_;
+  }
+
  private:
   std::unique_ptr<roq::codec::fix::Encoder> encoder_;
   std::string const sender_comp_id_;
   std::string const target_comp_id_;
+  std::unique_ptr<Journal> journal_;
   uint64_t msg_seq_num_ = {};
+  std::vector<std::byte> buffer_;
 };
 
 }  // namespace fix
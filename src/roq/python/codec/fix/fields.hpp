@@ -0,0 +1,672 @@
+/* Copyright (c) 2017-2024, Hans Erik Thrane */
+
+#pragma once
+
+#include <string_view>
+#include <type_traits>
+
+#include "roq/python/fields.hpp"
+
+#include "roq/python/codec/fix/details.hpp"
+
+namespace roq {
+namespace python {
+
+// note! field access for decoded messages (same names and order as the python properties)
+
+template <>
+struct utils::Fields<roq::fix::Header> final {
+  template <typename Callback>
+  static void apply(roq::fix::Header const &value, Callback &&callback) {
+    using namespace std::literals;
+    callback("msg_type"sv, value.msg_type);
+    callback("sender_comp_id"sv, value.sender_comp_id);
+    callback("target_comp_id"sv, value.target_comp_id);
+    callback("msg_seq_num"sv, value.msg_seq_num);
+    callback("sending_time"sv, value.sending_time);
+  }
+};
+
+template <>
+struct utils::Fields<roq::codec::fix::Logon> final {
+  template <typename Callback>
+  static void apply(roq::codec::fix::Logon const &value, Callback &&callback) {
+    using namespace std::literals;
+    callback("encrypt_method"sv, value.encrypt_method);
+    callback("heart_bt_int"sv, value.heart_bt_int);
+    callback("raw_data_length"sv, value.raw_data_length);
+    callback("raw_data"sv, value.raw_data);
+    callback("reset_seq_num_flag"sv, value.reset_seq_num_flag);
+    callback("next_expected_msg_seq_num"sv, value.next_expected_msg_seq_num);
+    callback("username"sv, value.username);
+    callback("password"sv, value.password);
+  }
+};
+
+template <>
+struct utils::Fields<roq::codec::fix::Logout> final {
+  template <typename Callback>
+  static void apply(roq::codec::fix::Logout const &value, Callback &&callback) {
+    using namespace std::literals;
+    callback("text"sv, value.text);
+  }
+};
+
+template <>
+struct utils::Fields<roq::codec::fix::TestRequest> final {
+  template <typename Callback>
+  static void apply(roq::codec::fix::TestRequest const &value, Callback &&callback) {
+    using namespace std::literals;
+    callback("test_req_id"sv, value.test_req_id);
+  }
+};
+
+template <>
+struct utils::Fields<roq::codec::fix::Heartbeat> final {
+  template <typename Callback>
+  static void apply(roq::codec::fix::Heartbeat const &value, Callback &&callback) {
+    using namespace std::literals;
+    callback("test_req_id"sv, value.test_req_id);
+  }
+};
+
+template <>
+struct utils::Fields<roq::codec::fix::ResendRequest> final {
+  template <typename Callback>
+  static void apply(roq::codec::fix::ResendRequest const &value, Callback &&callback) {
+    using namespace std::literals;
+    callback("begin_seq_no"sv, value.begin_seq_no);
+    callback("end_seq_no"sv, value.end_seq_no);
+  }
+};
+
+template <>
+struct utils::Fields<roq::codec::fix::Reject> final {
+  template <typename Callback>
+  static void apply(roq::codec::fix::Reject const &value, Callback &&callback) {
+    using namespace std::literals;
+    callback("ref_seq_num"sv, value.ref_seq_num);
+    callback("text"sv, value.text);
+    callback("ref_tag_id"sv, value.ref_tag_id);
+    callback("ref_msg_type"sv, value.ref_msg_type);
+    callback("session_reject_reason"sv, value.session_reject_reason);
+  }
+};
+
+template <>
+struct utils::Fields<roq::codec::fix::BusinessMessageReject> final {
+  template <typename Callback>
+  static void apply(roq::codec::fix::BusinessMessageReject const &value, Callback &&callback) {
+    using namespace std::literals;
+    callback("ref_seq_num"sv, value.ref_seq_num);
+    callback("ref_msg_type"sv, value.ref_msg_type);
+    callback("business_reject_ref_id"sv, value.business_reject_ref_id);
+    callback("business_reject_reason"sv, value.business_reject_reason);
+    callback("text"sv, value.text);
+  }
+};
+
+template <>
+struct utils::Fields<roq::codec::fix::UserRequest> final {
+  template <typename Callback>
+  static void apply(roq::codec::fix::UserRequest const &value, Callback &&callback) {
+    using namespace std::literals;
+    callback("user_request_id"sv, value.user_request_id);
+    callback("user_request_type"sv, value.user_request_type);
+    callback("username"sv, value.username);
+    callback("password"sv, value.password);
+    callback("new_password"sv, value.new_password);
+  }
+};
+
+template <>
+struct utils::Fields<roq::codec::fix::UserResponse> final {
+  template <typename Callback>
+  static void apply(roq::codec::fix::UserResponse const &value, Callback &&callback) {
+    using namespace std::literals;
+    callback("user_request_id"sv, value.user_request_id);
+    callback("username"sv, value.username);
+    callback("user_status"sv, value.user_status);
+    callback("user_status_text"sv, value.user_status_text);
+  }
+};
+
+template <>
+struct utils::Fields<roq::codec::fix::TradingSessionStatusRequest> final {
+  template <typename Callback>
+  static void apply(roq::codec::fix::TradingSessionStatusRequest const &value, Callback &&callback) {
+    using namespace std::literals;
+    callback("trad_ses_req_id"sv, value.trad_ses_req_id);
+    callback("trading_session_id"sv, value.trading_session_id);
+    callback("subscription_request_type"sv, value.subscription_request_type);
+  }
+};
+
+template <>
+struct utils::Fields<roq::codec::fix::TradingSessionStatus> final {
+  template <typename Callback>
+  static void apply(roq::codec::fix::TradingSessionStatus const &value, Callback &&callback) {
+    using namespace std::literals;
+    callback("trad_ses_req_id"sv, value.trad_ses_req_id);
+    callback("trading_session_id"sv, value.trading_session_id);
+    callback("unsolicited_indicator"sv, value.unsolicited_indicator);
+    callback("trad_ses_status"sv, value.trad_ses_status);
+    callback("trad_ses_status_rej_reason"sv, value.trad_ses_status_rej_reason);
+    callback("text"sv, value.text);
+  }
+};
+
+template <>
+struct utils::Fields<roq::codec::fix::SecurityListRequest> final {
+  template <typename Callback>
+  static void apply(roq::codec::fix::SecurityListRequest const &value, Callback &&callback) {
+    using namespace std::literals;
+    callback("security_req_id"sv, value.security_req_id);
+    callback("security_list_request_type"sv, value.security_list_request_type);
+    callback("symbol"sv, value.symbol);
+    callback("security_exchange"sv, value.security_exchange);
+    callback("trading_session_id"sv, value.trading_session_id);
+    callback("subscription_request_type"sv, value.subscription_request_type);
+  }
+};
+
+template <>
+struct utils::Fields<roq::codec::fix::SecListGrp> final {
+  // note! also provides mutable access (used when building entries from columns)
+  template <typename T, typename Callback>
+  static void apply(T &&value, Callback &&callback) {
+    static_assert(std::is_same<typename std::remove_cvref<T>::type, roq::codec::fix::SecListGrp>::value);
+    using namespace std::literals;
+    callback("symbol"sv, value.symbol);
+    callback("contract_multiplier"sv, value.contract_multiplier);
+    callback("security_exchange"sv, value.security_exchange);
+    callback("min_trade_vol"sv, value.min_trade_vol);
+    callback("trading_session_id"sv, value.trading_session_id);
+    callback("min_price_increment"sv, value.min_price_increment);
+  }
+};
+
+template <>
+struct utils::Fields<roq::codec::fix::SecurityList> final {
+  template <typename Callback>
+  static void apply(roq::codec::fix::SecurityList const &value, Callback &&callback) {
+    using namespace std::literals;
+    callback("security_req_id"sv, value.security_req_id);
+    callback("security_response_id"sv, value.security_response_id);
+    callback("security_request_result"sv, value.security_request_result);
+    callback("no_related_sym"sv, value.no_related_sym);
+  }
+};
+
+template <>
+struct utils::Fields<roq::codec::fix::SecurityDefinitionRequest> final {
+  template <typename Callback>
+  static void apply(roq::codec::fix::SecurityDefinitionRequest const &value, Callback &&callback) {
+    using namespace std::literals;
+    callback("security_req_id"sv, value.security_req_id);
+    callback("security_request_type"sv, value.security_request_type);
+    callback("symbol"sv, value.symbol);
+    callback("security_exchange"sv, value.security_exchange);
+    callback("trading_session_id"sv, value.trading_session_id);
+    callback("subscription_request_type"sv, value.subscription_request_type);
+  }
+};
+
+template <>
+struct utils::Fields<roq::codec::fix::SecurityDefinition> final {
+  template <typename Callback>
+  static void apply(roq::codec::fix::SecurityDefinition const &value, Callback &&callback) {
+    using namespace std::literals;
+    callback("security_req_id"sv, value.security_req_id);
+    callback("security_response_id"sv, value.security_response_id);
+    callback("security_response_type"sv, value.security_response_type);
+    callback("symbol"sv, value.symbol);
+    callback("contract_multiplier"sv, value.contract_multiplier);
+    callback("security_exchange"sv, value.security_exchange);
+    callback("trading_session_id"sv, value.trading_session_id);
+    callback("min_trade_vol"sv, value.min_trade_vol);
+    callback("min_price_increment"sv, value.min_price_increment);
+  }
+};
+
+template <>
+struct utils::Fields<roq::codec::fix::SecurityStatusRequest> final {
+  template <typename Callback>
+  static void apply(roq::codec::fix::SecurityStatusRequest const &value, Callback &&callback) {
+    using namespace std::literals;
+    callback("security_status_req_id"sv, value.security_status_req_id);
+    callback("symbol"sv, value.symbol);
+    callback("security_exchange"sv, value.security_exchange);
+    callback("subscription_request_type"sv, value.subscription_request_type);
+    callback("trading_session_id"sv, value.trading_session_id);
+  }
+};
+
+template <>
+struct utils::Fields<roq::codec::fix::SecurityStatus> final {
+  template <typename Callback>
+  static void apply(roq::codec::fix::SecurityStatus const &value, Callback &&callback) {
+    using namespace std::literals;
+    callback("security_status_req_id"sv, value.security_status_req_id);
+    callback("symbol"sv, value.symbol);
+    callback("security_exchange"sv, value.security_exchange);
+    callback("trading_session_id"sv, value.trading_session_id);
+    callback("unsolicited_indicator"sv, value.unsolicited_indicator);
+    callback("security_trading_status"sv, value.security_trading_status);
+    callback("transact_time"sv, value.transact_time);
+  }
+};
+
+template <>
+struct utils::Fields<roq::codec::fix::InstrmtMDReq> final {
+  // note! also provides mutable access (used when building entries from columns)
+  template <typename T, typename Callback>
+  static void apply(T &&value, Callback &&callback) {
+    static_assert(std::is_same<typename std::remove_cvref<T>::type, roq::codec::fix::InstrmtMDReq>::value);
+    using namespace std::literals;
+    callback("symbol"sv, value.symbol);
+    callback("security_exchange"sv, value.security_exchange);
+  }
+};
+
+template <>
+struct utils::Fields<roq::codec::fix::MarketDataRequest> final {
+  template <typename Callback>
+  static void apply(roq::codec::fix::MarketDataRequest const &value, Callback &&callback) {
+    using namespace std::literals;
+    callback("md_req_id"sv, value.md_req_id);
+    callback("subscription_request_type"sv, value.subscription_request_type);
+    callback("market_depth"sv, value.market_depth);
+    callback("md_update_type"sv, value.md_update_type);
+    callback("aggregated_book"sv, value.aggregated_book);
+    callback("no_md_entry_types"sv, value.no_md_entry_types);
+    callback("no_related_sym"sv, value.no_related_sym);
+    callback("no_trading_sessions"sv, value.no_trading_sessions);
+    callback("custom_type"sv, value.custom_type);
+    callback("custom_value"sv, value.custom_value);
+  }
+};
+
+template <>
+struct utils::Fields<roq::codec::fix::MarketDataRequestReject> final {
+  template <typename Callback>
+  static void apply(roq::codec::fix::MarketDataRequestReject const &value, Callback &&callback) {
+    using namespace std::literals;
+    callback("md_req_id"sv, value.md_req_id);
+    callback("md_req_rej_reason"sv, value.md_req_rej_reason);
+    callback("text"sv, value.text);
+  }
+};
+
+template <>
+struct utils::Fields<roq::codec::fix::MDFull> final {
+  // note! also provides mutable access (used when building entries from columns)
+  template <typename T, typename Callback>
+  static void apply(T &&value, Callback &&callback) {
+    static_assert(std::is_same<typename std::remove_cvref<T>::type, roq::codec::fix::MDFull>::value);
+    using namespace std::literals;
+    callback("md_entry_type"sv, value.md_entry_type);
+    callback("md_entry_px"sv, value.md_entry_px);
+    callback("md_entry_size"sv, value.md_entry_size);
+    callback("md_entry_date"sv, value.md_entry_date);
+    callback("md_entry_time"sv, value.md_entry_time);
+    callback("trading_session_id"sv, value.trading_session_id);
+    callback("expire_time"sv, value.expire_time);
+    callback("order_id"sv, value.order_id);
+    callback("number_of_orders"sv, value.number_of_orders);
+    callback("md_entry_position_no"sv, value.md_entry_position_no);
+  }
+};
+
+template <>
+struct utils::Fields<roq::codec::fix::MDInc> final {
+  // note! also provides mutable access (used when building entries from columns)
+  template <typename T, typename Callback>
+  static void apply(T &&value, Callback &&callback) {
+    static_assert(std::is_same<typename std::remove_cvref<T>::type, roq::codec::fix::MDInc>::value);
+    using namespace std::literals;
+    callback("md_update_action"sv, value.md_update_action);
+    callback("md_entry_type"sv, value.md_entry_type);
+    callback("symbol"sv, value.symbol);
+    callback("security_exchange"sv, value.security_exchange);
+    callback("md_entry_px"sv, value.md_entry_px);
+    callback("md_entry_size"sv, value.md_entry_size);
+    callback("md_entry_date"sv, value.md_entry_date);
+    callback("md_entry_time"sv, value.md_entry_time);
+    callback("trading_session_id"sv, value.trading_session_id);
+    callback("expire_time"sv, value.expire_time);
+    callback("order_id"sv, value.order_id);
+    callback("number_of_orders"sv, value.number_of_orders);
+    callback("md_entry_position_no"sv, value.md_entry_position_no);
+    callback("text"sv, value.text);
+  }
+};
+
+template <>
+struct utils::Fields<roq::codec::fix::MarketDataSnapshotFullRefresh> final {
+  template <typename Callback>
+  static void apply(roq::codec::fix::MarketDataSnapshotFullRefresh const &value, Callback &&callback) {
+    using namespace std::literals;
+    callback("md_req_id"sv, value.md_req_id);
+    callback("symbol"sv, value.symbol);
+    callback("security_exchange"sv, value.security_exchange);
+    callback("no_md_entries"sv, value.no_md_entries);
+  }
+};
+
+template <>
+struct utils::Fields<roq::codec::fix::MarketDataIncrementalRefresh> final {
+  template <typename Callback>
+  static void apply(roq::codec::fix::MarketDataIncrementalRefresh const &value, Callback &&callback) {
+    using namespace std::literals;
+    callback("md_req_id"sv, value.md_req_id);
+    callback("no_md_entries"sv, value.no_md_entries);
+  }
+};
+
+template <>
+struct utils::Fields<roq::codec::fix::OrderStatusRequest> final {
+  template <typename Callback>
+  static void apply(roq::codec::fix::OrderStatusRequest const &value, Callback &&callback) {
+    using namespace std::literals;
+    callback("order_id"sv, value.order_id);
+    callback("cl_ord_id"sv, value.cl_ord_id);
+    callback("no_party_ids"sv, value.no_party_ids);
+    callback("ord_status_req_id"sv, value.ord_status_req_id);
+    callback("account"sv, value.account);
+    callback("symbol"sv, value.symbol);
+    callback("security_exchange"sv, value.security_exchange);
+    callback("side"sv, value.side);
+  }
+};
+
+template <>
+struct utils::Fields<roq::codec::fix::OrderMassStatusRequest> final {
+  template <typename Callback>
+  static void apply(roq::codec::fix::OrderMassStatusRequest const &value, Callback &&callback) {
+    using namespace std::literals;
+    callback("mass_status_req_id"sv, value.mass_status_req_id);
+    callback("mass_status_req_type"sv, value.mass_status_req_type);
+    callback("no_party_ids"sv, value.no_party_ids);
+    callback("account"sv, value.account);
+    callback("trading_session_id"sv, value.trading_session_id);
+    callback("symbol"sv, value.symbol);
+    callback("security_exchange"sv, value.security_exchange);
+    callback("side"sv, value.side);
+  }
+};
+
+template <>
+struct utils::Fields<roq::codec::fix::NewOrderSingle> final {
+  template <typename Callback>
+  static void apply(roq::codec::fix::NewOrderSingle const &value, Callback &&callback) {
+    using namespace std::literals;
+    callback("cl_ord_id"sv, value.cl_ord_id);
+    callback("secondary_cl_ord_id"sv, value.secondary_cl_ord_id);
+    callback("no_party_ids"sv, value.no_party_ids);
+    callback("account"sv, value.account);
+    callback("handl_inst"sv, value.handl_inst);
+    callback("exec_inst"sv, value.exec_inst);
+    callback("no_trading_sessions"sv, value.no_trading_sessions);
+    callback("symbol"sv, value.symbol);
+    callback("security_exchange"sv, value.security_exchange);
+    callback("side"sv, value.side);
+    callback("transact_time"sv, value.transact_time);
+    callback("order_qty"sv, value.order_qty);
+    callback("ord_type"sv, value.ord_type);
+    callback("price"sv, value.price);
+    callback("stop_px"sv, value.stop_px);
+    callback("time_in_force"sv, value.time_in_force);
+    callback("text"sv, value.text);
+    callback("position_effect"sv, value.position_effect);
+    callback("max_show"sv, value.max_show);
+  }
+};
+
+template <>
+struct utils::Fields<roq::codec::fix::OrderCancelRequest> final {
+  template <typename Callback>
+  static void apply(roq::codec::fix::OrderCancelRequest const &value, Callback &&callback) {
+    using namespace std::literals;
+    callback("orig_cl_ord_id"sv, value.orig_cl_ord_id);
+    callback("order_id"sv, value.order_id);
+    callback("cl_ord_id"sv, value.cl_ord_id);
+    callback("secondary_cl_ord_id"sv, value.secondary_cl_ord_id);
+    callback("account"sv, value.account);
+    callback("no_party_ids"sv, value.no_party_ids);
+    callback("symbol"sv, value.symbol);
+    callback("security_exchange"sv, value.security_exchange);
+    callback("side"sv, value.side);
+    callback("transact_time"sv, value.transact_time);
+    callback("order_qty"sv, value.order_qty);
+    callback("text"sv, value.text);
+  }
+};
+
+template <>
+struct utils::Fields<roq::codec::fix::OrderCancelReplaceRequest> final {
+  template <typename Callback>
+  static void apply(roq::codec::fix::OrderCancelReplaceRequest const &value, Callback &&callback) {
+    using namespace std::literals;
+    callback("order_id"sv, value.order_id);
+    callback("no_party_ids"sv, value.no_party_ids);
+    callback("orig_cl_ord_id"sv, value.orig_cl_ord_id);
+    callback("cl_ord_id"sv, value.cl_ord_id);
+    callback("secondary_cl_ord_id"sv, value.secondary_cl_ord_id);
+    callback("account"sv, value.account);
+    callback("symbol"sv, value.symbol);
+    callback("security_exchange"sv, value.security_exchange);
+    callback("order_qty"sv, value.order_qty);
+    callback("price"sv, value.price);
+    callback("side"sv, value.side);
+    callback("transact_time"sv, value.transact_time);
+    callback("ord_type"sv, value.ord_type);
+  }
+};
+
+template <>
+struct utils::Fields<roq::codec::fix::OrderMassCancelRequest> final {
+  template <typename Callback>
+  static void apply(roq::codec::fix::OrderMassCancelRequest const &value, Callback &&callback) {
+    using namespace std::literals;
+    callback("cl_ord_id"sv, value.cl_ord_id);
+    callback("mass_cancel_request_type"sv, value.mass_cancel_request_type);
+    callback("trading_session_id"sv, value.trading_session_id);
+    callback("symbol"sv, value.symbol);
+    callback("security_exchange"sv, value.security_exchange);
+    callback("side"sv, value.side);
+    callback("transact_time"sv, value.transact_time);
+    callback("no_party_ids"sv, value.no_party_ids);
+  }
+};
+
+template <>
+struct utils::Fields<roq::codec::fix::OrderCancelReject> final {
+  template <typename Callback>
+  static void apply(roq::codec::fix::OrderCancelReject const &value, Callback &&callback) {
+    using namespace std::literals;
+    callback("order_id"sv, value.order_id);
+    callback("secondary_cl_ord_id"sv, value.secondary_cl_ord_id);
+    callback("cl_ord_id"sv, value.cl_ord_id);
+    callback("orig_cl_ord_id"sv, value.orig_cl_ord_id);
+    callback("ord_status"sv, value.ord_status);
+    callback("working_indicator"sv, value.working_indicator);
+    callback("account"sv, value.account);
+    callback("cxl_rej_response_to"sv, value.cxl_rej_response_to);
+    callback("cxl_rej_reason"sv, value.cxl_rej_reason);
+    callback("text"sv, value.text);
+  }
+};
+
+template <>
+struct utils::Fields<roq::codec::fix::OrderMassCancelReport> final {
+  template <typename Callback>
+  static void apply(roq::codec::fix::OrderMassCancelReport const &value, Callback &&callback) {
+    using namespace std::literals;
+    callback("cl_ord_id"sv, value.cl_ord_id);
+    callback("order_id"sv, value.order_id);
+    callback("mass_cancel_request_type"sv, value.mass_cancel_request_type);
+    callback("mass_cancel_response"sv, value.mass_cancel_response);
+    callback("mass_cancel_reject_reason"sv, value.mass_cancel_reject_reason);
+    callback("total_affected_orders"sv, value.total_affected_orders);
+    callback("symbol"sv, value.symbol);
+    callback("security_exchange"sv, value.security_exchange);
+    callback("side"sv, value.side);
+    callback("text"sv, value.text);
+    callback("no_party_ids"sv, value.no_party_ids);
+  }
+};
+
+template <>
+struct utils::Fields<roq::codec::fix::ExecutionReport> final {
+  template <typename Callback>
+  static void apply(roq::codec::fix::ExecutionReport const &value, Callback &&callback) {
+    using namespace std::literals;
+    callback("order_id"sv, value.order_id);
+    callback("secondary_cl_ord_id"sv, value.secondary_cl_ord_id);
+    callback("cl_ord_id"sv, value.cl_ord_id);
+    callback("orig_cl_ord_id"sv, value.orig_cl_ord_id);
+    callback("ord_status_req_id"sv, value.ord_status_req_id);
+    callback("mass_status_req_id"sv, value.mass_status_req_id);
+    callback("tot_num_reports"sv, value.tot_num_reports);
+    callback("last_rpt_requested"sv, value.last_rpt_requested);
+    callback("no_party_ids"sv, value.no_party_ids);
+    callback("exec_id"sv, value.exec_id);
+    callback("exec_type"sv, value.exec_type);
+    callback("ord_status"sv, value.ord_status);
+    callback("working_indicator"sv, value.working_indicator);
+    callback("ord_rej_reason"sv, value.ord_rej_reason);
+    callback("account"sv, value.account);
+    callback("account_type"sv, value.account_type);
+    callback("symbol"sv, value.symbol);
+    callback("security_exchange"sv, value.security_exchange);
+    callback("side"sv, value.side);
+    callback("ord_type"sv, value.ord_type);
+    callback("order_qty"sv, value.order_qty);
+    callback("price"sv, value.price);
+    callback("stop_px"sv, value.stop_px);
+    callback("currency"sv, value.currency);
+    callback("time_in_force"sv, value.time_in_force);
+    callback("exec_inst"sv, value.exec_inst);
+    callback("last_qty"sv, value.last_qty);
+    callback("last_px"sv, value.last_px);
+    callback("trading_session_id"sv, value.trading_session_id);
+    callback("leaves_qty"sv, value.leaves_qty);
+    callback("cum_qty"sv, value.cum_qty);
+    callback("avg_px"sv, value.avg_px);
+    callback("transact_time"sv, value.transact_time);
+    callback("position_effect"sv, value.position_effect);
+    callback("max_show"sv, value.max_show);
+    callback("text"sv, value.text);
+    callback("last_liquidity_ind"sv, value.last_liquidity_ind);
+  }
+};
+
+template <>
+struct utils::Fields<roq::codec::fix::TradeCaptureReportRequest> final {
+  template <typename Callback>
+  static void apply(roq::codec::fix::TradeCaptureReportRequest const &value, Callback &&callback) {
+    using namespace std::literals;
+    callback("trade_request_id"sv, value.trade_request_id);
+    callback("trade_request_type"sv, value.trade_request_type);
+    callback("subscription_request_type"sv, value.subscription_request_type);
+    callback("order_id"sv, value.order_id);
+    callback("cl_ord_id"sv, value.cl_ord_id);
+    callback("no_party_ids"sv, value.no_party_ids);
+    callback("symbol"sv, value.symbol);
+    callback("security_exchange"sv, value.security_exchange);
+  }
+};
+
+template <>
+struct utils::Fields<roq::codec::fix::TradeCaptureReport> final {
+  template <typename Callback>
+  static void apply(roq::codec::fix::TradeCaptureReport const &value, Callback &&callback) {
+    using namespace std::literals;
+    callback("trade_report_id"sv, value.trade_report_id);
+    callback("trade_request_id"sv, value.trade_request_id);
+    callback("exec_type"sv, value.exec_type);
+    callback("tot_num_trade_reports"sv, value.tot_num_trade_reports);
+    callback("last_rpt_requested"sv, value.last_rpt_requested);
+    callback("unsolicited_indicator"sv, value.unsolicited_indicator);
+    callback("trd_match_id"sv, value.trd_match_id);
+    callback("exec_id"sv, value.exec_id);
+    callback("previously_reported"sv, value.previously_reported);
+    callback("symbol"sv, value.symbol);
+    callback("security_exchange"sv, value.security_exchange);
+    callback("last_qty"sv, value.last_qty);
+    callback("last_px"sv, value.last_px);
+    callback("trade_date"sv, value.trade_date);
+    callback("transact_time"sv, value.transact_time);
+    callback("no_sides"sv, value.no_sides);
+  }
+};
+
+template <>
+struct utils::Fields<roq::codec::fix::RequestForPositions> final {
+  template <typename Callback>
+  static void apply(roq::codec::fix::RequestForPositions const &value, Callback &&callback) {
+    using namespace std::literals;
+    callback("pos_req_id"sv, value.pos_req_id);
+    callback("pos_req_type"sv, value.pos_req_type);
+    callback("subscription_request_type"sv, value.subscription_request_type);
+    callback("no_party_ids"sv, value.no_party_ids);
+    callback("account"sv, value.account);
+    callback("account_type"sv, value.account_type);
+    callback("currency"sv, value.currency);
+    callback("symbol"sv, value.symbol);
+    callback("security_exchange"sv, value.security_exchange);
+    callback("clearing_business_date"sv, value.clearing_business_date);
+    callback("no_trading_sessions"sv, value.no_trading_sessions);
+    callback("transact_time"sv, value.transact_time);
+  }
+};
+
+template <>
+struct utils::Fields<roq::codec::fix::RequestForPositionsAck> final {
+  template <typename Callback>
+  static void apply(roq::codec::fix::RequestForPositionsAck const &value, Callback &&callback) {
+    using namespace std::literals;
+    callback("pos_maint_rpt_id"sv, value.pos_maint_rpt_id);
+    callback("pos_req_id"sv, value.pos_req_id);
+    callback("total_num_pos_reports"sv, value.total_num_pos_reports);
+    callback("unsolicited_indicator"sv, value.unsolicited_indicator);
+    callback("pos_req_result"sv, value.pos_req_result);
+    callback("pos_req_status"sv, value.pos_req_status);
+    callback("no_party_ids"sv, value.no_party_ids);
+    callback("account"sv, value.account);
+    callback("account_type"sv, value.account_type);
+    callback("text"sv, value.text);
+  }
+};
+
+template <>
+struct utils::Fields<roq::codec::fix::PositionReport> final {
+  template <typename Callback>
+  static void apply(roq::codec::fix::PositionReport const &value, Callback &&callback) {
+    using namespace std::literals;
+    callback("pos_maint_rpt_id"sv, value.pos_maint_rpt_id);
+    callback("pos_req_id"sv, value.pos_req_id);
+    callback("pos_req_type"sv, value.pos_req_type);
+    callback("subscription_request_type"sv, value.subscription_request_type);
+    callback("total_num_pos_reports"sv, value.total_num_pos_reports);
+    callback("unsolicited_indicator"sv, value.unsolicited_indicator);
+    callback("pos_req_result"sv, value.pos_req_result);
+    callback("clearing_business_date"sv, value.clearing_business_date);
+    callback("no_party_ids"sv, value.no_party_ids);
+    callback("account"sv, value.account);
+    callback("account_type"sv, value.account_type);
+    callback("symbol"sv, value.symbol);
+    callback("security_exchange"sv, value.security_exchange);
+    callback("currency"sv, value.currency);
+    callback("settl_price"sv, value.settl_price);
+    callback("settl_price_type"sv, value.settl_price_type);
+    callback("prior_settl_price"sv, value.prior_settl_price);
+    callback("no_positions"sv, value.no_positions);
+    callback("no_pos_amt"sv, value.no_pos_amt);
+    callback("text"sv, value.text);
+  }
+};
+
+}  // namespace python
+}  // namespace roq
@@ -0,0 +1,283 @@
+/* Copyright (c) 2017-2024, Hans Erik Thrane */
+
+#pragma once
+
+#include <pybind11/numpy.h>
+#include <pybind11/pybind11.h>
+
+#include <fmt/format.h>
+
+#include <chrono>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <ratio>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <nameof.hpp>
+
+#include "roq/python/fields.hpp"
+#include "roq/python/utils.hpp"
+
+#include "roq/python/codec/fix/column.hpp"
+#include "roq/python/codec/fix/fields.hpp"
+
+namespace roq {
+namespace python {
+namespace codec {
+namespace fix {
+
+// note!
+//   read-only view of a repeating group (no per-entry objects unless an item is accessed)
+//   each field is exposed as a column (numpy array), e.g. md_entries.md_entry_px is float64
+//   T is the python wrapper (an item is only materialized by __getitem__)
+//   the view keeps the owning object alive, so storing it will be caught by the ref-count check after the callback
+
+template <typename T>
+struct Group final {
+  using value_type = typename T::value_type;
+
+  explicit Group(std::span<value_type const> const &values) : values_{values} {}
+
+  size_t size() const { return std::size(values_); }
+
+  T at(pybind11::ssize_t index) const {
+    using namespace std::literals;
+    if (index < 0)
+      index += static_cast<pybind11::ssize_t>(std::size(values_));
+    if (index < 0 || static_cast<size_t>(index) >= std::size(values_))
+      throw pybind11::index_error{"Index out of range"s};
+    return T{values_[index]};
+  }
+
+  // note! a _ns suffix returns time fields as int64 (nanoseconds)
+  pybind11::object column(std::string_view const &name) const {
+    using namespace std::literals;
+    auto nanoseconds = name.ends_with("_ns"sv);
+    auto name_2 = nanoseconds ? name.substr(0, std::size(name) - 3) : name;
+    auto index = find(name_2);
+    if (index == NOT_FOUND) {
+      index = find(name);
+      nanoseconds = false;
+    }
+    if (index == NOT_FOUND)
+      throw pybind11::key_error{fmt::format(R"(Unknown field "{}")"sv, name)};
+    Column result{name, nanoseconds};
+    for (auto &item : values_) {
+      size_t i = 0;
+      utils::Fields<value_type>::apply(item, [&](std::string_view const &, auto const &field) {
+        if (i++ == index)
+          result.append(field);
+      });
+    }
+    return result.to_array();
+  }
+
+  // note! single pass, i.e. each entry is visited once
+  pybind11::dict columns() const {
+    auto names = Group::names();
+    std::vector<Column> columns;
+    columns.reserve(std::size(names));
+    for (auto &name : names)
+      columns.emplace_back(name, false);
+    for (auto &item : values_) {
+      size_t i = 0;
+      utils::Fields<value_type>::apply(
+          item, [&](std::string_view const &, auto const &field) { columns[i++].append(field); });
+    }
+    pybind11::dict result;
+    for (size_t i = 0; i < std::size(names); ++i)
+      result[pybind11::str{names[i]}] = columns[i].to_array();
+    return result;
+  }
+
+  std::span<value_type const> const &values() const { return values_; }
+
+  static std::vector<std::string> names() {
+    std::vector<std::string> result;
+    utils::Fields<value_type>::apply(
+        value_type{}, [&](std::string_view const &name, auto const &) { result.emplace_back(name); });
+    return result;
+  }
+
+  // note! returns the index of a field (NOT_FOUND if unknown)
+  static size_t find(std::string_view const &name) {
+    size_t result = NOT_FOUND, i = 0;
+    utils::Fields<value_type>::apply(value_type{}, [&](std::string_view const &name_2, auto const &) {
+      if (name_2 == name)
+        result = i;
+      ++i;
+    });
+    return result;
+  }
+
+  static constexpr size_t NOT_FOUND = std::numeric_limits<size_t>::max();
+
+ private:
+  std::span<value_type const> const values_;
+};
+
+// note!
+//   builds a repeating group from columns, i.e. {field: array}, without creating per-entry python objects
+//   numeric fields accept anything convertible to a numpy array, strings and enums accept any sequence
+//   enums can be given by name, time fields as datetime64 / timedelta64 or int64 (nanoseconds)
+//   missing fields are default initialized
+
+template <typename T>
+std::vector<T> from_columns(pybind11::dict const &columns) {
+  using namespace std::literals;
+  using value_type = typename T::value_type;
+  auto names = Group<T>::names();
+  std::vector<pybind11::object> inputs(std::size(names));
+  size_t size = std::numeric_limits<size_t>::max();
+  for (auto [key, item] : columns) {
+    auto name = key.cast<std::string_view>();
+    auto index = Group<T>::find(name);
+    if (index == Group<T>::NOT_FOUND)
+      throw pybind11::key_error{fmt::format(R"(Unknown field "{}")"sv, name)};
+    auto length = pybind11::len(item);
+    if (size == std::numeric_limits<size_t>::max())
+      size = length;
+    else if (length != size)
+      throw std::invalid_argument{"All columns must have the same length"s};
+    inputs[index] = pybind11::reinterpret_borrow<pybind11::object>(item);
+  }
+  if (size == std::numeric_limits<size_t>::max())
+    return {};
+  // note! each column is converted once (the type is decided by the field), rows are then read directly
+  constexpr auto flags = pybind11::array::c_style | pybind11::array::forcecast;
+  auto numpy = pybind11::module_::import("numpy");
+  auto to_nanoseconds = [&](pybind11::object const &input, char const *dtype) {
+    return pybind11::array_t<int64_t, flags>(
+        numpy.attr("asarray")(input).attr("astype")(dtype).attr("view")("int64"));
+  };
+  std::vector<void const *> data(std::size(names));
+  {
+    size_t i = 0;
+    utils::Fields<value_type>::apply(value_type{}, [&](std::string_view const &name, auto const &field) {
+      using field_type = std::remove_cvref<decltype(field)>::type;
+      auto &input = inputs[i];
+      auto &data_2 = data[i];
+      ++i;
+      if (!input)
+        return;
+      auto helper = [&](auto array) {
+        data_2 = array.data();
+        input = std::move(array);
+      };
+      if constexpr (requires { field.value; }) {
+        helper(pybind11::array_t<double, flags>(input));
+      } else if constexpr (std::is_same<field_type, bool>::value) {
+        helper(pybind11::array_t<bool, flags>(input));
+      } else if constexpr (std::is_floating_point<field_type>::value) {
+        helper(pybind11::array_t<double, flags>(input));
+      } else if constexpr (std::is_enum<field_type>::value || std::is_same<field_type, std::string_view>::value) {
+        input = pybind11::list(input);
+      } else if constexpr (std::is_integral<field_type>::value) {
+        helper(pybind11::array_t<int64_t, flags>(input));
+      } else if constexpr (std::is_same<field_type, std::chrono::year_month_day>::value) {
+        helper(to_nanoseconds(input, "datetime64[ns]"));
+      } else if constexpr (is_hh_mm_ss<field_type>::value) {
+        helper(to_nanoseconds(input, "timedelta64[ns]"));
+      } else if constexpr (utils::is_duration<field_type>::value) {
+        if constexpr (std::ratio_greater_equal<typename field_type::period, std::ratio<1>>::value)
+          helper(to_nanoseconds(input, "timedelta64[ns]"));
+        else
+          helper(to_nanoseconds(input, "datetime64[ns]"));
+      } else {
+        throw std::invalid_argument{fmt::format(R"(Unsupported field "{}")"sv, name)};
+      }
+    });
+  }
+  std::vector<T> result;
+  result.reserve(size);
+  for (size_t row = 0; row < size; ++row) {
+    value_type value = {};
+    size_t i = 0;
+    utils::Fields<value_type>::apply(value, [&]([[maybe_unused]] std::string_view const &name, auto &field) {
+      using field_type = std::remove_cvref<decltype(field)>::type;
+      auto &input = inputs[i];
+      auto data_2 = data[i];
+      ++i;
+      if (!input)
+        return;
+      if constexpr (requires { field.value; }) {
+        field.value = static_cast<double const *>(data_2)[row];
+      } else if constexpr (std::is_same<field_type, bool>::value) {
+        field = static_cast<bool const *>(data_2)[row];
+      } else if constexpr (std::is_floating_point<field_type>::value) {
+        field = static_cast<double const *>(data_2)[row];
+      } else if constexpr (std::is_enum<field_type>::value) {
+        pybind11::object item = pybind11::list(input)[row];
+        if (pybind11::isinstance<pybind11::str>(item)) {
+          auto tmp = magic_enum::enum_cast<field_type>(item.cast<std::string_view>());
+          if (!tmp.has_value())
+            throw std::invalid_argument{fmt::format(R"(Unknown enum value for "{}")"sv, name)};
+          field = *tmp;
+        } else {
+          field = item.cast<field_type>();
+        }
+      } else if constexpr (std::is_integral<field_type>::value) {
+        field = static_cast<field_type>(static_cast<int64_t const *>(data_2)[row]);
+      } else if constexpr (std::is_same<field_type, std::string_view>::value) {
+        // note! the list holds a reference to the string, i.e. the view is valid until the entry has been copied
+        field = pybind11::list(input)[row].cast<std::string_view>();
+      } else if constexpr (std::is_same<field_type, std::chrono::year_month_day>::value) {
+        std::chrono::sys_time<std::chrono::nanoseconds> time_point{
+            std::chrono::nanoseconds{static_cast<int64_t const *>(data_2)[row]}};
+        field = std::chrono::year_month_day{std::chrono::floor<std::chrono::days>(time_point)};
+      } else if constexpr (is_hh_mm_ss<field_type>::value) {
+        std::chrono::nanoseconds nanoseconds{static_cast<int64_t const *>(data_2)[row]};
+        field = field_type{std::chrono::duration_cast<typename field_type::precision>(nanoseconds)};
+      } else if constexpr (utils::is_duration<field_type>::value) {
+        std::chrono::nanoseconds nanoseconds{static_cast<int64_t const *>(data_2)[row]};
+        field = std::chrono::duration_cast<field_type>(nanoseconds);
+      }
+    });
+    result.emplace_back(value);
+  }
+  return result;
+}
+
+// note! registers the view type, e.g. MDFullGroup
+template <typename T>
+void create_group(pybind11::module_ &module) {
+  using value_type = Group<T>;
+  std::string name{nameof::nameof_short_type<T>()};
+  name += "Group";
+  pybind11::class_<value_type> result(module, name.c_str());
+  result.def("__len__", [](value_type const &self) { return self.size(); })
+      .def("__getitem__", [](value_type const &self, pybind11::ssize_t index) { return self.at(index); })
+      .def(
+          "column",
+          [](value_type const &self, std::string_view const &name) { return self.column(name); },
+          pybind11::arg("name"),
+          "Field values as a numpy array (a _ns suffix returns time fields as int64)")
+      .def(
+          "columns",
+          [](value_type const &self) { return self.columns(); },
+          "All fields as {name: numpy array}")
+      .def("__repr__", [](value_type const &self) {
+        using namespace std::literals;
+        std::string result;
+        for (auto &item : self.values()) {
+          if (!std::empty(result))
+            result += ", "sv;
+          fmt::format_to(std::back_inserter(result), "{}"sv, item);
+        }
+        return fmt::format("[{}]"sv, result);
+      });
+  for (auto &name_2 : value_type::names())
+    result.def_property_readonly(name_2.c_str(), [name_2](value_type const &self) { return self.column(name_2); });
+}
+
+}  // namespace fix
+}  // namespace codec
+}  // namespace python
+}  // namespace roq
@@ -0,0 +1,213 @@
+/* Copyright (c) 2017-2024, Hans Erik Thrane */
+
+#pragma once
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+namespace roq {
+namespace python {
+namespace codec {
+namespace fix {
+
+// note!
+//   append-only journal of outbound messages, memory-mapped and indexed by MsgSeqNum
+//   layout: header (magic, used bytes) followed by records (msg_seq_num, length, message)
+//   the index is rebuilt when an existing file is opened, i.e. sequence numbers can be resumed
+//   a lower sequence number (sequence reset) discards the index (old records remain in the file)
+//   the index is dense, a forward jump larger than MAXIMUM_GAP is therefore rejected
+//   rebuild stops at the first implausible record (anything following is considered corrupt and overwritten)
+//   data is written to the page cache (no msync), i.e. it survives a process crash but not a system crash
+
+struct Journal final {
+  explicit Journal(std::string_view const &path) : path_{path} {
+    using namespace std::literals;
+    fd_ = ::open(path_.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+    if (fd_ < 0)
+      throw std::system_error{errno, std::generic_category(), "open"s};
+    struct stat stat = {};
+    if (::fstat(fd_, &stat) < 0) {
+      auto error = errno;
+      ::close(fd_);
+      throw std::system_error{error, std::generic_category(), "fstat"s};
+    }
+    try {
+      auto size = static_cast<size_t>(stat.st_size);
+      if (size < HEADER_SIZE) {
+        resize(INITIAL_CAPACITY);
+        std::memcpy(data_, std::data(MAGIC), std::size(MAGIC));
+        set_used(HEADER_SIZE);
+      } else {
+        map(size);
+        if (std::string_view{reinterpret_cast<char const *>(data_), std::size(MAGIC)} != MAGIC)
+          throw std::runtime_error{"Unexpected file format"s};
+        rebuild();
+      }
+    } catch (...) {
+      unmap();
+      ::close(fd_);
+      throw;
+    }
+  }
+
+  Journal(Journal const &) = delete;
+
+  ~Journal() {
+    unmap();
+    if (fd_ >= 0)
+      ::close(fd_);
+  }
+
+  uint64_t last_msg_seq_num() const { return std::empty(index_) ? 0 : first_msg_seq_num_ + std::size(index_) - 1; }
+
+  void append(uint64_t msg_seq_num, std::span<std::byte const> const &message) {
+    if (!is_plausible(msg_seq_num)) {
+      using namespace std::literals;
+      throw std::invalid_argument{"Unexpected sequence number"s};
+    }
+    auto used = get_used();
+    auto required = used + RECORD_HEADER_SIZE + std::size(message);
+    if (required > capacity_) {
+      auto capacity = capacity_;
+      while (capacity < required)
+        capacity *= 2;
+      resize(capacity);
+    }
+    auto length = static_cast<uint32_t>(std::size(message));
+    std::memcpy(data_ + used, &msg_seq_num, sizeof(msg_seq_num));
+    std::memcpy(data_ + used + sizeof(msg_seq_num), &length, sizeof(length));
+    std::memcpy(data_ + used + RECORD_HEADER_SIZE, std::data(message), std::size(message));
+    add(msg_seq_num, used);
+    // note! the record is only visible (after a restart) once the header has been updated
+    set_used(required);
+  }
+
+  // note! removes the last record (used to roll back a failed encode)
+  void pop_back() {
+    if (std::empty(index_))
+      return;
+    auto offset = index_.back();
+    index_.pop_back();
+    while (!std::empty(index_) && index_.back() == UNKNOWN)
+      index_.pop_back();
+    set_used(offset);
+  }
+
+  // note! returns an empty span if the message is not available
+  std::span<std::byte const> get(uint64_t msg_seq_num) const {
+    if (msg_seq_num < first_msg_seq_num_ || msg_seq_num > last_msg_seq_num())
+      return {};
+    auto offset = index_[msg_seq_num - first_msg_seq_num_];
+    if (offset == UNKNOWN)
+      return {};
+    uint32_t length = {};
+    std::memcpy(&length, data_ + offset + sizeof(uint64_t), sizeof(length));
+    return {data_ + offset + RECORD_HEADER_SIZE, length};
+  }
+
+ protected:
+  static constexpr std::string_view MAGIC = "ROQFIXJ1";
+  static constexpr size_t HEADER_SIZE = 16;
+  static constexpr size_t RECORD_HEADER_SIZE = sizeof(uint64_t) + sizeof(uint32_t);
+  static constexpr size_t INITIAL_CAPACITY = 1 << 20;
+  static constexpr uint64_t UNKNOWN = std::numeric_limits<uint64_t>::max();
+  static constexpr uint64_t MAXIMUM_GAP = 1 << 20;
+
+  uint64_t get_used() const {
+    uint64_t result = {};
+    std::memcpy(&result, data_ + std::size(MAGIC), sizeof(result));
+    return result;
+  }
+
+  void set_used(uint64_t value) { std::memcpy(data_ + std::size(MAGIC), &value, sizeof(value)); }
+
+  void add(uint64_t msg_seq_num, uint64_t offset) {
+    if (std::empty(index_) || msg_seq_num <= last_msg_seq_num()) {
+      index_.clear();
+      first_msg_seq_num_ = msg_seq_num;
+    }
+    while (first_msg_seq_num_ + std::size(index_) < msg_seq_num)
+      index_.emplace_back(UNKNOWN);
+    index_.emplace_back(offset);
+  }
+
+  // note! a truncated (partially written) trailing record is ignored
+  void rebuild() {
+    auto used = std::min<uint64_t>(get_used(), capacity_);
+    uint64_t offset = HEADER_SIZE;
+    while ((offset + RECORD_HEADER_SIZE) <= used) {
+      uint64_t msg_seq_num = {};
+      uint32_t length = {};
+      std::memcpy(&msg_seq_num, data_ + offset, sizeof(msg_seq_num));
+      std::memcpy(&length, data_ + offset + sizeof(msg_seq_num), sizeof(length));
+      auto next = offset + RECORD_HEADER_SIZE + length;
+      if (next > used || !is_plausible(msg_seq_num) || !is_message({data_ + offset + RECORD_HEADER_SIZE, length}))
+        break;
+      add(msg_seq_num, offset);
+      offset = next;
+    }
+    set_used(offset);
+  }
+
+  bool is_plausible(uint64_t msg_seq_num) const {
+    if (!msg_seq_num || msg_seq_num == UNKNOWN)
+      return false;
+    return std::empty(index_) || msg_seq_num <= last_msg_seq_num() || (msg_seq_num - last_msg_seq_num()) <= MAXIMUM_GAP;
+  }
+
+  static bool is_message(std::span<std::byte const> const &message) {
+    using namespace std::literals;
+    std::string_view message_2{reinterpret_cast<char const *>(std::data(message)), std::size(message)};
+    return message_2.starts_with("8="sv);
+  }
+
+  void resize(size_t capacity) {
+    using namespace std::literals;
+    if (::ftruncate(fd_, static_cast<off_t>(capacity)) < 0)
+      throw std::system_error{errno, std::generic_category(), "ftruncate"s};
+    unmap();
+    map(capacity);
+  }
+
+  void map(size_t capacity) {
+    using namespace std::literals;
+    auto data = ::mmap(nullptr, capacity, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+    if (data == MAP_FAILED)
+      throw std::system_error{errno, std::generic_category(), "mmap"s};
+    data_ = static_cast<std::byte *>(data);
+    capacity_ = capacity;
+  }
+
+  void unmap() {
+    if (data_ != nullptr)
+      ::munmap(data_, capacity_);
+    data_ = nullptr;
+    capacity_ = {};
+  }
+
+ private:
+  std::string const path_;
+  int fd_ = -1;
+  std::byte *data_ = nullptr;
+  size_t capacity_ = {};
+  uint64_t first_msg_seq_num_ = {};
+  std::vector<uint64_t> index_;
+};
+
+}  // namespace fix
+}  // namespace codec
+}  // namespace python
+}  // namespace roq
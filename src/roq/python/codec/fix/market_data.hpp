@@ -0,0 +1,181 @@
+/* Copyright (c) 2017-2024, Hans Erik Thrane */
+
+#pragma once
+
+#include <map>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "roq/api.hpp"
+
+#include "roq/python/codec/fix/decoder.hpp"
+
+#include "roq/python/market/mbp/details.hpp"
+
+namespace roq {
+namespace python {
+namespace codec {
+namespace fix {
+
+// note!
+//   market data (MarketDataSnapshotFullRefresh, MarketDataIncrementalRefresh) is applied directly to order books
+//   books are created on demand and keyed by symbol (MDReqID if the feed doesn't include the symbol)
+//   books are never removed (references remain valid), clear() resets their state
+//   the update callback receives the symbol of each changed book (once per message, after all entries were applied)
+//   all other messages are passed to the callback (same as the decoder)
+
+struct MarketDataAdapter final {
+  MarketDataAdapter(
+      std::string_view const &exchange, roq::Precision price_precision, roq::Precision quantity_precision, bool view)
+      : decoder_{view, {}}, exchange_{exchange}, price_precision_{price_precision},
+        quantity_precision_{quantity_precision} {}
+
+  // note! returns the number of bytes decoded (complete messages)
+  template <typename Callback, typename Update>
+  size_t feed(Callback const &callback, Update const &update, std::span<std::byte const> const &buffer) {
+    Filter<Update> filter{*this, update};
+    return decoder_.feed(callback, filter, buffer);
+  }
+
+  roq::python::market::mbp::MarketByPrice &get(std::string_view const &symbol) {
+    using namespace std::literals;
+    auto iter = books_.find(symbol);
+    if (iter == std::end(books_))
+      throw pybind11::key_error{"Unknown symbol"s};
+    return (*iter).second;
+  }
+
+  std::vector<std::string> symbols() const {
+    std::vector<std::string> result;
+    for (auto &[symbol, _] : books_)
+      result.emplace_back(symbol);
+    return result;
+  }
+
+  void clear() {
+    for (auto &[_, book] : books_)
+      book.clear();
+  }
+
+ protected:
+  // note! called by the decoder before anything is converted to python, returns false when consumed
+  template <typename Update>
+  struct Filter final {
+    template <typename T>
+    bool operator()(roq::fix::Header const &header, T const &value) {
+      if constexpr (std::is_same<T, roq::codec::fix::MarketDataSnapshotFullRefresh>::value) {
+        adapter.apply(header, value);
+      } else if constexpr (std::is_same<T, roq::codec::fix::MarketDataIncrementalRefresh>::value) {
+        adapter.apply(header, value);
+      } else {
+        return true;
+      }
+      for (auto &symbol : adapter.changed_)
+        update(symbol);
+      return false;
+    }
+
+    MarketDataAdapter &adapter;
+    Update const &update;
+  };
+
+  void apply(roq::fix::Header const &header, roq::codec::fix::MarketDataSnapshotFullRefresh const &value) {
+    changed_.clear();
+    bids_.clear();
+    asks_.clear();
+    for (auto &item : value.no_md_entries)
+      add(item.md_entry_type, roq::fix::MDUpdateAction::NEW, item.md_entry_px.value, item.md_entry_size.value);
+    flush(header, get_key(value.symbol, value.md_req_id), UpdateType::SNAPSHOT);
+  }
+
+  // note!
+  //   entries are grouped by symbol (consecutive), an empty symbol means same as the previous entry
+  //   entries without a (preceding) symbol are keyed by MDReqID
+  void apply(roq::fix::Header const &header, roq::codec::fix::MarketDataIncrementalRefresh const &value) {
+    changed_.clear();
+    bids_.clear();
+    asks_.clear();
+    std::string_view key;
+    for (auto &item : value.no_md_entries) {
+      auto key_2 = std::empty(item.symbol) ? (std::empty(key) ? get_key({}, value.md_req_id) : key) : item.symbol;
+      if (key_2 != key) {
+        if (!std::empty(key))
+          flush(header, key, UpdateType::INCREMENTAL);
+        key = key_2;
+      }
+      add(item.md_entry_type, item.md_update_action, item.md_entry_px.value, item.md_entry_size.value);
+    }
+    if (!std::empty(key))
+      flush(header, key, UpdateType::INCREMENTAL);
+  }
+
+  static std::string_view get_key(std::string_view const &symbol, std::string_view const &md_req_id) {
+    using namespace std::literals;
+    if (!std::empty(symbol))
+      return symbol;
+    if (!std::empty(md_req_id))
+      return md_req_id;
+    throw std::runtime_error{"Expected symbol or md_req_id"s};
+  }
+
+  // note! delete is represented by zero quantity
+  void add(roq::fix::MDEntryType md_entry_type, roq::fix::MDUpdateAction md_update_action, double price, double size) {
+    auto quantity = md_update_action == roq::fix::MDUpdateAction::DELETE ? 0.0 : size;
+    auto mbp_update = MBPUpdate{
+        .price = price,
+        .quantity = quantity,
+    };
+    switch (md_entry_type) {
+      case roq::fix::MDEntryType::BID:
+        bids_.emplace_back(mbp_update);
+        break;
+      case roq::fix::MDEntryType::OFFER:
+        asks_.emplace_back(mbp_update);
+        break;
+      default:
+        break;
+    }
+  }
+
+  void flush(roq::fix::Header const &header, std::string_view const &symbol, UpdateType update_type) {
+    auto market_by_price_update = MarketByPriceUpdate{
+        .exchange = exchange_,
+        .symbol = symbol,
+        .bids = bids_,
+        .asks = asks_,
+        .update_type = update_type,
+        .exchange_time_utc = header.sending_time,
+        .price_precision = price_precision_,
+        .quantity_precision = quantity_precision_,
+    };
+    auto iter = books_.find(symbol);
+    if (iter == std::end(books_))
+      iter = books_.try_emplace(std::string{symbol}, exchange_, symbol).first;
+    (*iter).second(market_by_price_update);
+    bids_.clear();
+    asks_.clear();
+    for (auto &item : changed_)
+      if (item == symbol)
+        return;
+    changed_.emplace_back(symbol);
+  }
+
+ private:
+  Decoder decoder_;
+  std::string const exchange_;
+  roq::Precision const price_precision_;
+  roq::Precision const quantity_precision_;
+  std::map<std::string, roq::python::market::mbp::MarketByPrice, std::less<>> books_;
+  std::vector<MBPUpdate> bids_;
+  std::vector<MBPUpdate> asks_;
+  std::vector<std::string_view> changed_;
+};
+
+}  // namespace fix
+}  // namespace codec
+}  // namespace python
+}  // namespace roq
@@ -10,9 +10,14 @@
 
 #include "roq/python/utils.hpp"
 
+#include "roq/python/codec/fix/decode_file.hpp"
 #include "roq/python/codec/fix/decoder.hpp"
 #include "roq/python/codec/fix/details.hpp"
+#include "roq/python/codec/fix/group.hpp"
 #include "roq/python/codec/fix/header.hpp"
+#include "roq/python/codec/fix/market_data.hpp"
+#include "roq/python/codec/fix/order_template.hpp"
+#include "roq/python/codec/fix/session.hpp"
 
 using namespace std::literals;
 
@@ -29,8 +34,28 @@ void Module::create(pybind11::module_ &module) {
   utils::create_struct<roq::python::codec::fix::MDFull>(module);
   utils::create_struct<roq::python::codec::fix::MDInc>(module);
 
+  utils::create_struct<roq::python::codec::fix::Group<roq::python::codec::fix::InstrmtMDReq>>(module);
+  utils::create_struct<roq::python::codec::fix::Group<roq::python::codec::fix::SecListGrp>>(module);
+  utils::create_struct<roq::python::codec::fix::Group<roq::python::codec::fix::MDFull>>(module);
+  utils::create_struct<roq::python::codec::fix::Group<roq::python::codec::fix::MDInc>>(module);
+
   utils::create_struct<roq::python::codec::fix::Encodeable>(module);
   utils::create_struct<roq::python::codec::fix::Encoder>(module);
+  utils::create_struct<roq::python::codec::fix::OrderTemplate>(module);
+
+  utils::create_enum<roq::python::codec::fix::SessionState>(module);
+  utils::create_struct<roq::python::codec::fix::Session>(module);
+
+  utils::create_struct<roq::python::codec::fix::MarketDataAdapter>(module);
+
+  module.def(
+      "decode_file",
+      &roq::python::codec::fix::decode_file,
+      pybind11::arg("path"),
+      pybind11::arg("msg_types") = std::vector<roq::fix::MsgType>{},
+      pybind11::arg("fields") = std::map<roq::fix::MsgType, std::vector<std::string>>{},
+      pybind11::arg("threads") = 1,
+      "Decode a FIX capture file into column arrays, returns {msg_type: {field: array}}");
 
   utils::create_ref_struct_2<roq::python::codec::fix::Logon, roq::python::codec::fix::Encodeable>(module);
   utils::create_ref_struct_2<roq::python::codec::fix::Logout, roq::python::codec::fix::Encodeable>(module);
@@ -99,6 +124,45 @@ void Module::create(pybind11::module_ &module) {
 
   utils::create_struct<roq::python::codec::fix::Header>(module);
   utils::create_struct<roq::python::codec::fix::Decoder>(module);
+
+  // views (decoder)
+
+  utils::create_ref_struct<roq::fix::Header>(module);
+  utils::create_ref_struct<roq::codec::fix::Logon>(module);
+  utils::create_ref_struct<roq::codec::fix::Logout>(module);
+  utils::create_ref_struct<roq::codec::fix::TestRequest>(module);
+  utils::create_ref_struct<roq::codec::fix::Heartbeat>(module);
+  utils::create_ref_struct<roq::codec::fix::ResendRequest>(module);
+  utils::create_ref_struct<roq::codec::fix::Reject>(module);
+  utils::create_ref_struct<roq::codec::fix::BusinessMessageReject>(module);
+  utils::create_ref_struct<roq::codec::fix::UserRequest>(module);
+  utils::create_ref_struct<roq::codec::fix::UserResponse>(module);
+  utils::create_ref_struct<roq::codec::fix::TradingSessionStatusRequest>(module);
+  utils::create_ref_struct<roq::codec::fix::TradingSessionStatus>(module);
+  utils::create_ref_struct<roq::codec::fix::SecurityListRequest>(module);
+  utils::create_ref_struct<roq::codec::fix::SecurityList>(module);
+  utils::create_ref_struct<roq::codec::fix::SecurityDefinitionRequest>(module);
+  utils::create_ref_struct<roq::codec::fix::SecurityDefinition>(module);
+  utils::create_ref_struct<roq::codec::fix::SecurityStatusRequest>(module);
+  utils::create_ref_struct<roq::codec::fix::SecurityStatus>(module);
+  utils::create_ref_struct<roq::codec::fix::MarketDataRequest>(module);
+  utils::create_ref_struct<roq::codec::fix::MarketDataRequestReject>(module);
+  utils::create_ref_struct<roq::codec::fix::MarketDataSnapshotFullRefresh>(module);
+  utils::create_ref_struct<roq::codec::fix::MarketDataIncrementalRefresh>(module);
+  utils::create_ref_struct<roq::codec::fix::OrderStatusRequest>(module);
+  utils::create_ref_struct<roq::codec::fix::OrderMassStatusRequest>(module);
+  utils::create_ref_struct<roq::codec::fix::NewOrderSingle>(module);
+  utils::create_ref_struct<roq::codec::fix::OrderCancelRequest>(module);
+  utils::create_ref_struct<roq::codec::fix::OrderCancelReplaceRequest>(module);
+  utils::create_ref_struct<roq::codec::fix::OrderMassCancelRequest>(module);
+  utils::create_ref_struct<roq::codec::fix::OrderCancelReject>(module);
+  utils::create_ref_struct<roq::codec::fix::OrderMassCancelReport>(module);
+  utils::create_ref_struct<roq::codec::fix::ExecutionReport>(module);
+  utils::create_ref_struct<roq::codec::fix::TradeCaptureReportRequest>(module);
+  utils::create_ref_struct<roq::codec::fix::TradeCaptureReport>(module);
+  utils::create_ref_struct<roq::codec::fix::RequestForPositions>(module);
+  utils::create_ref_struct<roq::codec::fix::RequestForPositionsAck>(module);
+  utils::create_ref_struct<roq::codec::fix::PositionReport>(module);
 }
 
 }  // namespace fix
@@ -0,0 +1,189 @@
+/* Copyright (c) 2017-2024, Hans Erik Thrane */
+
+#pragma once
+
+#include <fmt/format.h>
+
+#include <chrono>
+#include <cmath>
+#include <iterator>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+#include "roq/python/codec/fix/encodeable.hpp"
+#include "roq/python/codec/fix/encoder.hpp"
+
+namespace roq {
+namespace python {
+namespace codec {
+namespace fix {
+
+// note!
+//   the prototype message is encoded once and split into static and dynamic fields
+//   each send only formats the dynamic fields (MsgSeqNum, SendingTime, ClOrdID, OrigClOrdID, TransactTime, OrderQty,
+//   Price) and patches BodyLength and CheckSum
+//   body fields are re-ordered (static before dynamic), which is allowed by the protocol
+//   OrigClOrdID is required by OrderCancelReplaceRequest (G) and OrderCancelRequest (F)
+
+struct OrderTemplate final {
+  OrderTemplate(Encoder &encoder, Encodeable const &prototype, uint8_t price_decimals, uint8_t quantity_decimals)
+      : encoder_{encoder}, price_decimals_{price_decimals}, quantity_decimals_{quantity_decimals} {
+    using namespace std::literals;
+    Encoder scratch{encoder.sender_comp_id(), encoder.target_comp_id()};
+    auto message = scratch.encode(prototype, {});
+    std::string_view remaining{reinterpret_cast<char const *>(std::data(message)), std::size(message)};
+    std::string msg_type;
+    while (!std::empty(remaining)) {
+      auto end = remaining.find(SOH);
+      if (end == remaining.npos)
+        break;
+      auto field = remaining.substr(0, end + 1);
+      remaining.remove_prefix(end + 1);
+      auto separator = field.find('=');
+      if (separator == field.npos)
+        continue;
+      auto tag = field.substr(0, separator);
+      auto value = field.substr(separator + 1, std::size(field) - separator - 2);
+      if (tag == "8"sv) {
+        begin_string_ = value;
+      } else if (tag == "35"sv) {
+        msg_type = value;
+      } else if (!is_managed(tag)) {
+        static_.append(field);
+      }
+    }
+    if (std::empty(begin_string_) || std::empty(msg_type))
+      throw std::invalid_argument{"Unable to parse prototype"s};
+    requires_orig_cl_ord_id_ = msg_type == "G"sv || msg_type == "F"sv;
+    // note! the static part of the header is moved in front of the body
+    header_ = fmt::format(
+        "35={}{}49={}{}56={}{}"sv,
+        msg_type,
+        SOH,
+        encoder.sender_comp_id(),
+        SOH,
+        encoder.target_comp_id(),
+        SOH);
+    checksum_ = checksum(header_) + checksum(static_);
+  }
+
+  std::span<std::byte const> encode(
+      std::string_view const &cl_ord_id,
+      double price,
+      double quantity,
+      std::string_view const &orig_cl_ord_id,
+      std::chrono::nanoseconds sending_time) {
+    using namespace std::literals;
+    // note! validated before the sequence number is consumed
+    if (requires_orig_cl_ord_id_ && std::empty(orig_cl_ord_id))
+      throw std::invalid_argument{"Expected orig_cl_ord_id"s};
+    body_.clear();
+    body_.append(header_);
+    auto offset = std::size(body_);
+    auto msg_seq_num = encoder_.next_msg_seq_num();
+    fmt::format_to(std::back_inserter(body_), "34={}{}52="sv, msg_seq_num, SOH);
+    append_timestamp(sending_time);
+    body_ += SOH;
+    auto dynamic = checksum(std::string_view{body_}.substr(offset));
+    body_.append(static_);
+    offset = std::size(body_);
+    fmt::format_to(std::back_inserter(body_), "11={}{}"sv, cl_ord_id, SOH);
+    if (!std::empty(orig_cl_ord_id))
+      fmt::format_to(std::back_inserter(body_), "41={}{}"sv, orig_cl_ord_id, SOH);
+    body_.append("60="sv);
+    append_timestamp(sending_time);
+    body_ += SOH;
+    if (!std::isnan(quantity)) {
+      body_.append("38="sv);
+      append_decimal(quantity, quantity_decimals_);
+      body_ += SOH;
+    }
+    if (!std::isnan(price)) {
+      body_.append("44="sv);
+      append_decimal(price, price_decimals_);
+      body_ += SOH;
+    }
+    dynamic += checksum(std::string_view{body_}.substr(offset));
+    message_.clear();
+    fmt::format_to(std::back_inserter(message_), "8={}{}9={}{}"sv, begin_string_, SOH, std::size(body_), SOH);
+    auto total = checksum(message_) + checksum_ + dynamic;
+    message_.append(body_);
+    fmt::format_to(std::back_inserter(message_), "10={:03}{}"sv, total % 256, SOH);
+    std::span result{reinterpret_cast<std::byte const *>(std::data(message_)), std::size(message_)};
+    encoder_.append_journal(msg_seq_num, result);
+    return result;
+  }
+
+ protected:
+  static constexpr char SOH = '\x01';
+
+  static bool is_managed(std::string_view const &tag) {
+    using namespace std::literals;
+    for (auto item : {"9"sv, "10"sv, "49"sv, "56"sv, "34"sv, "52"sv, "11"sv, "41"sv, "60"sv, "38"sv, "44"sv})
+      if (tag == item)
+        return true;
+    return false;
+  }
+
+  static uint32_t checksum(std::string_view const &value) {
+    uint32_t result = {};
+    for (auto c : value)
+      result += static_cast<uint8_t>(c);
+    return result;
+  }
+
+  // note! UTCTimestamp with millisecond resolution, the date/time part is cached per second
+  void append_timestamp(std::chrono::nanoseconds value) {
+    using namespace std::literals;
+    auto seconds = std::chrono::duration_cast<std::chrono::seconds>(value);
+    if (seconds != timestamp_seconds_ || std::empty(timestamp_)) {
+      timestamp_seconds_ = seconds;
+      auto days = std::chrono::floor<std::chrono::days>(seconds);
+      std::chrono::year_month_day ymd{std::chrono::sys_days{days}};
+      std::chrono::hh_mm_ss hms{seconds - days};
+      timestamp_ = fmt::format(
+          "{:04}{:02}{:02}-{:02}:{:02}:{:02}"sv,
+          static_cast<int>(ymd.year()),
+          static_cast<unsigned>(ymd.month()),
+          static_cast<unsigned>(ymd.day()),
+          hms.hours().count(),
+          hms.minutes().count(),
+          hms.seconds().count());
+    }
+    auto milliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(value - seconds).count();
+    fmt::format_to(std::back_inserter(body_), "{}.{:03}"sv, timestamp_, milliseconds);
+  }
+
+  void append_decimal(double value, uint8_t decimals) {
+    using namespace std::literals;
+    auto offset = std::size(body_);
+    fmt::format_to(std::back_inserter(body_), "{:.{}f}"sv, value, decimals);
+    if (std::string_view{body_}.substr(offset).find('.') == std::string_view::npos)
+      return;
+    while (body_.back() == '0')
+      body_.pop_back();
+    if (body_.back() == '.')
+      body_.pop_back();
+  }
+
+ private:
+  Encoder &encoder_;
+  uint8_t const price_decimals_;
+  uint8_t const quantity_decimals_;
+  std::string begin_string_;
+  std::string header_;
+  std::string static_;
+  uint32_t checksum_ = {};
+  bool requires_orig_cl_ord_id_ = false;
+  std::string body_;
+  std::string message_;
+  std::chrono::seconds timestamp_seconds_ = {};
+  std::string timestamp_;
+};
+
+}  // namespace fix
+}  // namespace codec
+}  // namespace python
+}  // namespace roq
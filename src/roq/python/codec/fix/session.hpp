@@ -0,0 +1,569 @@
+/* Copyright (c) 2017-2024, Hans Erik Thrane */
+
+#pragma once
+
+#include <fmt/format.h>
+
+#include <charconv>
+#include <chrono>
+#include <functional>
+#include <iterator>
+#include <map>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#include "roq/python/codec/fix/decoder.hpp"
+#include "roq/python/codec/fix/encodeable.hpp"
+#include "roq/python/codec/fix/encoder.hpp"
+
+namespace roq {
+namespace python {
+namespace codec {
+namespace fix {
+
+enum class SessionState : uint8_t {
+  DISCONNECTED,
+  LOGON_SENT,
+  READY,
+  LOGOUT_SENT,
+};
+
+// note!
+//   session layer (Logon, Logout, Heartbeat, TestRequest, ResendRequest and sequencing) is managed natively
+//   only application messages (and Reject) are passed to the callback
+//   transport is owned by the caller: inbound data is fed, outbound data is passed to the send function
+//   timer() must be called periodically (e.g. every second) to drive heartbeats and timeouts
+//   the session can act as initiator (logon) or acceptor (responds to an inbound Logon)
+//   inbound sequencing is applied to the raw message (before decoding), see intercept()
+//   an exception (e.g. raised by the callback) rolls back the sequence number of the failed message
+//     (the decoder retains the message, the following feed will therefore dispatch it again)
+//   an (optional) journal allows application messages to be re-sent and the outbound sequence number to be resumed
+
+struct Session final {
+  using Send = std::function<void(std::span<std::byte const> const &)>;
+
+  Session(
+      Send const &send,
+      std::string_view const &sender_comp_id,
+      std::string_view const &target_comp_id,
+      std::string_view const &username,
+      std::string_view const &password,
+      std::chrono::seconds heart_bt_int,
+      bool view,
+      std::string_view const &journal)
+      : send_{send}, encoder_{sender_comp_id, target_comp_id, journal}, decoder_{view, {}}, username_{username},
+        password_{password}, heart_bt_int_{heart_bt_int} {}
+
+  SessionState state() const { return state_; }
+
+  // note! last sequence number received from the counterparty
+  uint64_t msg_seq_num() const { return msg_seq_num_; }
+
+  // note! e.g. when resuming a session (any queued messages are discarded)
+  void set_msg_seq_num(uint64_t msg_seq_num) {
+    msg_seq_num_ = msg_seq_num;
+    rollback_ = {};
+    resend_end_ = {};
+    queue_.clear();
+  }
+
+  size_t gaps() const { return gaps_; }
+  size_t duplicates() const { return duplicates_; }
+  size_t queued() const { return std::size(queue_); }
+
+  Encoder &encoder() { return encoder_; }
+
+  void logon() {
+    auto logon = roq::codec::fix::Logon{
+        .encrypt_method = roq::fix::EncryptMethod::NONE,
+        .heart_bt_int = static_cast<uint16_t>(heart_bt_int_.count()),
+        .raw_data_length = {},
+        .raw_data = {},
+        .reset_seq_num_flag = {},
+        .next_expected_msg_seq_num = {},
+        .username = username_,
+        .password = password_,
+    };
+    write(logon);
+    change_state(SessionState::LOGON_SENT);
+  }
+
+  void logout(std::string_view const &text) {
+    auto logout = roq::codec::fix::Logout{
+        .text = text,
+    };
+    write(logout);
+    change_state(SessionState::LOGOUT_SENT);
+  }
+
+  void send(Encodeable const &encodeable) {
+    auto message = encoder_.encode(encodeable, std::chrono::system_clock::now());
+    send_(message);
+    last_send_ = now();
+  }
+
+  // note! returns the number of bytes consumed (complete messages), queued messages are dispatched once in sequence
+  template <typename Callback>
+  size_t feed(Callback const &callback, std::span<std::byte const> const &buffer) {
+    last_receive_ = now();
+    test_request_time_ = {};
+    Filter filter{*this};
+    size_t result = {};
+    try {
+      result = decoder_.feed(callback, filter, buffer);
+    } catch (...) {
+      if (rollback_)
+        msg_seq_num_ = *rollback_;
+      rollback_ = {};
+      throw;
+    }
+    rollback_ = {};
+    drain(callback, filter);
+    return result;
+  }
+
+  // note! returns false if the connection should be closed (timeout)
+  bool timer() {
+    using namespace std::literals;
+    auto now = this->now();
+    switch (state_) {
+      case SessionState::DISCONNECTED:
+        break;
+      case SessionState::LOGON_SENT:
+      case SessionState::LOGOUT_SENT:
+        if ((now - state_time_) >= (heart_bt_int_.count() ? heart_bt_int_ : LOGON_TIMEOUT)) {
+          change_state(SessionState::DISCONNECTED);
+          return false;
+        }
+        break;
+      case SessionState::READY:
+        if (!heart_bt_int_.count())
+          break;
+        if ((now - last_send_) >= heart_bt_int_) {
+          auto heartbeat = roq::codec::fix::Heartbeat{
+              .test_req_id = {},
+          };
+          write(heartbeat);
+        }
+        if (test_request_time_.count()) {
+          if ((now - test_request_time_) >= heart_bt_int_) {
+            change_state(SessionState::DISCONNECTED);
+            return false;
+          }
+        } else if ((now - last_receive_) >= (heart_bt_int_ + heart_bt_int_ / 5)) {
+          auto test_req_id = fmt::format("{}"sv, ++test_req_id_);
+          auto test_request = roq::codec::fix::TestRequest{
+              .test_req_id = test_req_id,
+          };
+          write(test_request);
+          test_request_time_ = now;
+        }
+        break;
+    }
+    return true;
+  }
+
+ protected:
+  static constexpr char SOH = '\x01';
+  static constexpr size_t CHECKSUM_LENGTH = 7;  // "10=nnn|"
+  static constexpr size_t MAXIMUM_QUEUED = 65536;
+  // note! used when heart_bt_int is zero
+  static constexpr std::chrono::seconds LOGON_TIMEOUT{10};
+
+  // note! called by the decoder before anything is converted to python, returns false when consumed
+  struct Filter final {
+    template <typename T>
+    bool operator()(roq::fix::Header const &header, T const &value) {
+      return session.filter(header, value);
+    }
+
+    size_t intercept(std::span<std::byte const> const &buffer) { return session.intercept(buffer); }
+
+    Session &session;
+  };
+
+  // note! session fields used for sequencing (parsed from the raw message)
+  struct Fields final {
+    std::string_view msg_type;
+    uint64_t msg_seq_num = {};
+    bool poss_dup_flag = false;
+    bool gap_fill_flag = false;
+    uint64_t new_seq_no = {};
+  };
+
+  // note! messages reaching the filter have already been sequenced
+  template <typename T>
+  bool filter([[maybe_unused]] roq::fix::Header const &header, [[maybe_unused]] T const &value) {
+    // note! the logon response must precede any resend request
+    if constexpr (std::is_same<T, roq::codec::fix::Logon>::value) {
+      if (state_ != SessionState::LOGON_SENT) {
+        heart_bt_int_ = std::chrono::seconds{value.heart_bt_int};
+        logon();
+      }
+      change_state(SessionState::READY);
+      return false;
+    }
+    if constexpr (std::is_same<T, roq::codec::fix::Logout>::value) {
+      if (state_ != SessionState::LOGOUT_SENT)
+        logout({});
+      change_state(SessionState::DISCONNECTED);
+      return false;
+    } else if constexpr (std::is_same<T, roq::codec::fix::TestRequest>::value) {
+      auto heartbeat = roq::codec::fix::Heartbeat{
+          .test_req_id = value.test_req_id,
+      };
+      write(heartbeat);
+      return false;
+    } else if constexpr (std::is_same<T, roq::codec::fix::Heartbeat>::value) {
+      return false;
+    } else if constexpr (std::is_same<T, roq::codec::fix::ResendRequest>::value) {
+      resend(value.begin_seq_no, value.end_seq_no);
+      return false;
+    } else {
+      return true;
+    }
+  }
+
+  // note!
+  //   called for each (complete) message before it is decoded, returns the length of the message when consumed
+  //   a gap triggers a resend request, messages above the expected sequence number are queued until the gap is filled
+  //   Logon and ResendRequest are processed immediately (their sequence number is queued as a placeholder)
+  //   SequenceReset (GapFill) advances the expected sequence number, SequenceReset (Reset) applies immediately
+  //   messages below the expected sequence number are dropped, a missing PossDupFlag triggers a logout
+  size_t intercept(std::span<std::byte const> const &buffer) {
+    using namespace std::literals;
+    rollback_ = {};  // note! the previous message was dispatched
+    auto length = frame(buffer);
+    if (!length)
+      return 0;  // note! incomplete (or malformed, the decoder will deal with it)
+    std::string_view message{reinterpret_cast<char const *>(std::data(buffer)), length};
+    auto fields = parse(message);
+    if (fields.msg_type == "4"sv && !fields.gap_fill_flag) {
+      sequence_reset(fields.new_seq_no);
+      return length;
+    }
+    auto expected = msg_seq_num_ + 1;
+    if (fields.msg_seq_num < expected) {
+      if (fields.msg_type == "A"sv)
+        return 0;
+      ++duplicates_;
+      if (!fields.poss_dup_flag && state_ == SessionState::READY)
+        logout(fmt::format("MsgSeqNum too low, expecting {} but received {}"sv, expected, fields.msg_seq_num));
+      return length;
+    }
+    if (fields.msg_seq_num > expected) {
+      auto immediate = fields.msg_type == "A"sv || fields.msg_type == "2"sv;
+      // note! the resend request is sent by drain (e.g. the logon response must be sent first)
+      enqueue(fields.msg_seq_num, immediate ? std::string_view{} : message);
+      return immediate ? 0 : length;
+    }
+    if (fields.msg_type == "4"sv) {
+      msg_seq_num_ = fields.msg_seq_num;
+      sequence_reset(fields.new_seq_no);
+      return length;
+    }
+    // note! rolled back by feed if the message fails to dispatch
+    rollback_ = msg_seq_num_;
+    msg_seq_num_ = fields.msg_seq_num;
+    return 0;
+  }
+
+  // note! dispatches queued messages once in sequence, requests a resend if a gap remains (and none is pending)
+  template <typename Callback>
+  void drain(Callback const &callback, Filter &filter) {
+    using namespace std::literals;
+    while (!std::empty(queue_)) {
+      auto iter = std::begin(queue_);
+      auto msg_seq_num = (*iter).first;
+      if (msg_seq_num <= msg_seq_num_) {
+        queue_.erase(iter);
+        continue;
+      }
+      if (msg_seq_num != (msg_seq_num_ + 1))
+        break;
+      auto message = std::move((*iter).second);
+      queue_.erase(iter);
+      auto previous = msg_seq_num_;
+      msg_seq_num_ = msg_seq_num;
+      if (std::empty(message))
+        continue;
+      if (auto fields = parse(message); fields.msg_type == "4"sv) {
+        sequence_reset(fields.new_seq_no);
+        continue;
+      }
+      std::span buffer{reinterpret_cast<std::byte const *>(std::data(message)), std::size(message)};
+      try {
+        decoder_.dispatch(callback, filter, buffer);
+      } catch (...) {
+        // note! re-queued, i.e. dispatched again by the following feed
+        msg_seq_num_ = previous;
+        queue_.try_emplace(msg_seq_num, std::move(message));
+        throw;
+      }
+    }
+    if (!std::empty(queue_) && resend_end_ <= msg_seq_num_)
+      resend_request(msg_seq_num_ + 1, (*std::begin(queue_)).first - 1);
+  }
+
+  void enqueue(uint64_t msg_seq_num, std::string_view const &message) {
+    using namespace std::literals;
+    if (std::size(queue_) >= MAXIMUM_QUEUED)
+      throw std::runtime_error{"Too many queued messages"s};
+    queue_.try_emplace(msg_seq_num, message);
+  }
+
+  void resend_request(uint64_t begin_seq_no, uint64_t end_seq_no) {
+    ++gaps_;
+    auto resend_request = roq::codec::fix::ResendRequest{
+        .begin_seq_no = begin_seq_no,
+        .end_seq_no = end_seq_no,
+    };
+    write(resend_request);
+    resend_end_ = end_seq_no;
+  }
+
+  // note! a lower NewSeqNo is ignored
+  void sequence_reset(uint64_t new_seq_no) {
+    if (new_seq_no > (msg_seq_num_ + 1))
+      msg_seq_num_ = new_seq_no - 1;
+  }
+
+  // note! returns the length of the first message (0 if incomplete or not recognized)
+  static size_t frame(std::span<std::byte const> const &buffer) {
+    using namespace std::literals;
+    std::string_view data{reinterpret_cast<char const *>(std::data(buffer)), std::size(buffer)};
+    if (!data.starts_with("8="sv))
+      return 0;
+    auto begin_string = data.find(SOH);
+    if (begin_string == data.npos || data.substr(begin_string + 1, 2) != "9="sv)
+      return 0;
+    auto offset = begin_string + 3;
+    auto end = data.find(SOH, offset);
+    if (end == data.npos)
+      return 0;
+    auto body_length = parse_integer(data.substr(offset, end - offset));
+    auto result = end + 1 + body_length + CHECKSUM_LENGTH;
+    return result <= std::size(data) ? result : 0;
+  }
+
+  static Fields parse(std::string_view const &message) {
+    using namespace std::literals;
+    Fields result;
+    for_each_field(message, [&](auto &tag, auto &value, [[maybe_unused]] auto &field) {
+      if (tag == "35"sv)
+        result.msg_type = value;
+      else if (tag == "34"sv)
+        result.msg_seq_num = parse_integer(value);
+      else if (tag == "43"sv)
+        result.poss_dup_flag = value == "Y"sv;
+      else if (tag == "123"sv)
+        result.gap_fill_flag = value == "Y"sv;
+      else if (tag == "36"sv)
+        result.new_seq_no = parse_integer(value);
+    });
+    return result;
+  }
+
+  // note! returns 0 if not a valid integer
+  static uint64_t parse_integer(std::string_view const &value) {
+    uint64_t result = {};
+    auto [ptr, ec] = std::from_chars(std::data(value), std::data(value) + std::size(value), result);
+    if (ec != std::errc{} || ptr != (std::data(value) + std::size(value)))
+      return 0;
+    return result;
+  }
+
+  // note!
+  //   without a journal the requested range is gap-filled (SequenceReset)
+  //   with a journal, application messages are re-sent (PossDupFlag) and session messages are gap-filled
+  void resend(uint64_t begin_seq_no, uint64_t end_seq_no) {
+    auto last = encoder_.msg_seq_num();
+    if (!end_seq_no || end_seq_no > last)
+      end_seq_no = last;
+    if (!begin_seq_no || begin_seq_no > end_seq_no)
+      return;
+    auto journal = encoder_.journal();
+    if (journal == nullptr) {
+      send_sequence_reset(begin_seq_no, end_seq_no + 1);
+      return;
+    }
+    uint64_t gap_fill = {};
+    for (auto msg_seq_num = begin_seq_no; msg_seq_num <= end_seq_no; ++msg_seq_num) {
+      auto record = (*journal).get(msg_seq_num);
+      std::string_view message{reinterpret_cast<char const *>(std::data(record)), std::size(record)};
+      if (std::empty(message) || is_session_message(message)) {
+        if (!gap_fill)
+          gap_fill = msg_seq_num;
+        continue;
+      }
+      if (gap_fill) {
+        send_sequence_reset(gap_fill, msg_seq_num);
+        gap_fill = {};
+      }
+      send_poss_dup(message);
+    }
+    if (gap_fill)
+      send_sequence_reset(gap_fill, end_seq_no + 1);
+  }
+
+  // note! the codec doesn't support SequenceReset, the message is therefore formatted here (and parsed by intercept)
+  void send_sequence_reset(uint64_t msg_seq_num, uint64_t new_seq_no) {
+    using namespace std::literals;
+    auto sending_time = format_timestamp(std::chrono::system_clock::now().time_since_epoch());
+    body_.clear();
+    fmt::format_to(
+        std::back_inserter(body_),
+        "35=4{0}49={1}{0}56={2}{0}34={3}{0}43=Y{0}52={4}{0}122={4}{0}123=Y{0}36={5}{0}"sv,
+        SOH,
+        encoder_.sender_comp_id(),
+        encoder_.target_comp_id(),
+        msg_seq_num,
+        sending_time,
+        new_seq_no);
+    send_body();
+  }
+
+  // note! the original header is replaced (PossDupFlag, OrigSendingTime and a new SendingTime)
+  void send_poss_dup(std::string_view const &message) {
+    using namespace std::literals;
+    std::string_view msg_type, msg_seq_num, orig_sending_time;
+    for_each_field(message, [&](auto &tag, auto &value, [[maybe_unused]] auto &field) {
+      if (tag == "35"sv)
+        msg_type = value;
+      else if (tag == "34"sv)
+        msg_seq_num = value;
+      else if (tag == "52"sv)
+        orig_sending_time = value;
+    });
+    auto sending_time = format_timestamp(std::chrono::system_clock::now().time_since_epoch());
+    body_.clear();
+    fmt::format_to(
+        std::back_inserter(body_),
+        "35={1}{0}49={2}{0}56={3}{0}34={4}{0}43=Y{0}52={5}{0}122={6}{0}"sv,
+        SOH,
+        msg_type,
+        encoder_.sender_comp_id(),
+        encoder_.target_comp_id(),
+        msg_seq_num,
+        sending_time,
+        orig_sending_time);
+    for_each_field(message, [&](auto &tag, [[maybe_unused]] auto &value, auto &field) {
+      for (auto item : {"8"sv, "9"sv, "10"sv, "35"sv, "49"sv, "56"sv, "34"sv, "43"sv, "52"sv, "97"sv, "122"sv})
+        if (tag == item)
+          return;
+      body_.append(field);
+    });
+    send_body();
+  }
+
+  // note! adds BeginString, BodyLength and CheckSum
+  void send_body() {
+    using namespace std::literals;
+    message_.clear();
+    fmt::format_to(std::back_inserter(message_), "8=FIX.4.4{}9={}{}"sv, SOH, std::size(body_), SOH);
+    message_.append(body_);
+    uint32_t checksum = {};
+    for (auto c : message_)
+      checksum += static_cast<uint8_t>(c);
+    fmt::format_to(std::back_inserter(message_), "10={:03}{}"sv, checksum % 256, SOH);
+    send_({reinterpret_cast<std::byte const *>(std::data(message_)), std::size(message_)});
+    last_send_ = now();
+  }
+
+  // note! callback(tag, value, field) where field includes the trailing separator
+  template <typename Callback>
+  static void for_each_field(std::string_view message, Callback const &callback) {
+    while (!std::empty(message)) {
+      auto end = message.find(SOH);
+      if (end == message.npos)
+        break;
+      auto field = message.substr(0, end + 1);
+      message.remove_prefix(end + 1);
+      auto separator = field.find('=');
+      if (separator == field.npos)
+        continue;
+      auto tag = field.substr(0, separator);
+      auto value = field.substr(separator + 1, std::size(field) - separator - 2);
+      callback(tag, value, field);
+    }
+  }
+
+  // note! session messages are gap-filled, never re-sent
+  static bool is_session_message(std::string_view const &message) {
+    using namespace std::literals;
+    auto result = false;
+    for_each_field(message, [&](auto &tag, auto &value, [[maybe_unused]] auto &field) {
+      if (tag != "35"sv)
+        return;
+      for (auto item : {"0"sv, "1"sv, "2"sv, "3"sv, "4"sv, "5"sv, "A"sv})
+        if (value == item)
+          result = true;
+    });
+    return result;
+  }
+
+  template <typename T>
+  void write(T const &value) {
+    auto message = encoder_.encode(value, std::chrono::system_clock::now().time_since_epoch());
+    send_(message);
+    last_send_ = now();
+  }
+
+  void change_state(SessionState state) {
+    state_ = state;
+    state_time_ = now();
+  }
+
+  static std::chrono::nanoseconds now() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch());
+  }
+
+  static std::string format_timestamp(std::chrono::nanoseconds value) {
+    using namespace std::literals;
+    auto seconds = std::chrono::duration_cast<std::chrono::seconds>(value);
+    auto days = std::chrono::floor<std::chrono::days>(seconds);
+    std::chrono::year_month_day ymd{std::chrono::sys_days{days}};
+    std::chrono::hh_mm_ss hms{seconds - days};
+    return fmt::format(
+        "{:04}{:02}{:02}-{:02}:{:02}:{:02}.{:03}"sv,
+        static_cast<int>(ymd.year()),
+        static_cast<unsigned>(ymd.month()),
+        static_cast<unsigned>(ymd.day()),
+        hms.hours().count(),
+        hms.minutes().count(),
+        hms.seconds().count(),
+        std::chrono::duration_cast<std::chrono::milliseconds>(value - seconds).count());
+  }
+
+ private:
+  Send const send_;
+  Encoder encoder_;
+  Decoder decoder_;
+  std::string const username_;
+  std::string const password_;
+  std::chrono::seconds heart_bt_int_;
+  SessionState state_ = {};
+  std::chrono::nanoseconds state_time_ = {};
+  std::chrono::nanoseconds last_send_ = {};
+  std::chrono::nanoseconds last_receive_ = {};
+  std::chrono::nanoseconds test_request_time_ = {};
+  uint64_t test_req_id_ = {};
+  uint64_t msg_seq_num_ = {};
+  std::optional<uint64_t> rollback_;
+  uint64_t resend_end_ = {};
+  std::map<uint64_t, std::string> queue_;
+  size_t gaps_ = {};
+  size_t duplicates_ = {};
+  std::string body_;
+  std::string message_;
+};
+
+}  // namespace fix
+}  // namespace codec
+}  // namespace python
+}  // namespace roq
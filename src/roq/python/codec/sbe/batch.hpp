@@ -0,0 +1,141 @@
+/* Copyright (c) 2017-2024, Hans Erik Thrane */
+
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include "roq/codec/udp/decoder.hpp"
+#include "roq/codec/udp/header.hpp"
+
+#include "roq/python/codec/sbe/encoder.hpp"
+
+namespace roq {
+namespace python {
+namespace codec {
+namespace sbe {
+
+// note!
+//   packs many encoded messages into one contiguous buffer (offsets and lengths describe each message)
+//   an optional udp header is prepended to each message, i.e. each message becomes a datagram
+//     the sequence number is incremented for each message (starting from the sequence number of the header)
+//     last_sequence_number defaults to the sequence number of the datagram (each message is a complete object)
+//       a snapshot should pass the sequence number of the incremental feed it reflects
+//     fragmentation is not supported (fragment and fragment_max are zero)
+//     the header is encoded field by field (the layout is verified against the udp decoder)
+//   memory is reused after clear(), i.e. any view of data() is invalidated by append() and clear()
+
+struct Batch final {
+  using header_type = roq::codec::udp::Header;
+
+  explicit Batch(std::optional<header_type> const &header) : header_{header} {
+    if (header_.has_value()) {
+      verify();
+      (*header_).fragment = {};
+      (*header_).fragment_max = {};
+    }
+  }
+
+  template <typename T>
+  void append(
+      MessageInfo const &message_info, T const &value, std::optional<uint64_t> const &last_sequence_number = {}) {
+    auto message = encoder_(message_info, value);
+    auto offset = std::size(buffer_);
+    auto length = std::size(message) + (header_.has_value() ? sizeof(header_type) : 0);
+    buffer_.resize(offset + length);
+    auto destination = std::data(buffer_) + offset;
+    if (header_.has_value()) {
+      auto &header = *header_;
+      using last_sequence_number_type = std::remove_cvref<decltype(header.last_sequence_number)>::type;
+      header.last_sequence_number = last_sequence_number.has_value()
+                                        ? static_cast<last_sequence_number_type>(*last_sequence_number)
+                                        : header.sequence_number;
+      encode({destination, sizeof(header_type)}, header);
+      destination += sizeof(header_type);
+      ++header.sequence_number;
+    }
+    std::memcpy(destination, std::data(message), std::size(message));
+    offsets_.emplace_back(static_cast<int64_t>(offset));
+    lengths_.emplace_back(static_cast<int64_t>(length));
+  }
+
+  void clear() {
+    buffer_.clear();
+    offsets_.clear();
+    lengths_.clear();
+  }
+
+  size_t size() const { return std::size(offsets_); }
+
+  std::span<std::byte const> data() const { return buffer_; }
+  std::span<int64_t const> offsets() const { return offsets_; }
+  std::span<int64_t const> lengths() const { return lengths_; }
+
+  // note! the sequence number of the next message
+  std::optional<uint64_t> sequence_number() const {
+    if (header_.has_value())
+      return (*header_).sequence_number;
+    return {};
+  }
+
+ protected:
+  // note! fields are written in declaration order (little-endian, no padding)
+  static void encode(std::span<std::byte> const &buffer, header_type const &header) {
+    static_assert(std::endian::native == std::endian::little);
+    size_t offset = {};
+    auto helper = [&](auto value) {
+      std::memcpy(std::data(buffer) + offset, &value, sizeof(value));
+      offset += sizeof(value);
+    };
+    helper(header.control);
+    helper(header.object_type);
+    helper(header.session_id);
+    helper(header.sequence_number);
+    helper(header.fragment);
+    helper(header.fragment_max);
+    helper(header.object_id);
+    helper(header.last_sequence_number);
+  }
+
+  // note! verifies (once) that encode is the inverse of the udp decoder
+  static void verify() {
+    using namespace std::literals;
+    static bool const result = []() {
+      header_type header = {};
+      header.session_id = 0x0102;
+      header.sequence_number = 0x03040506;
+      header.fragment = 0x07;
+      header.fragment_max = 0x08;
+      header.object_id = 0x090a;
+      header.last_sequence_number = 0x0b0c0d0e;
+      std::array<std::byte, sizeof(header_type)> buffer = {};
+      encode(buffer, header);
+      header_type header_2 = {};
+      roq::codec::udp::Decoder::decode(header_2, buffer);
+      return header_2.session_id == header.session_id && header_2.sequence_number == header.sequence_number &&
+             header_2.fragment == header.fragment && header_2.fragment_max == header.fragment_max &&
+             header_2.object_id == header.object_id && header_2.last_sequence_number == header.last_sequence_number;
+    }();
+    if (!result)
+      throw std::runtime_error{"Unexpected udp header layout"s};
+  }
+
+ private:
+  Encoder encoder_;
+  std::optional<header_type> header_;
+  std::vector<std::byte> buffer_;
+  std::vector<int64_t> offsets_;
+  std::vector<int64_t> lengths_;
+};
+
+}  // namespace sbe
+}  // namespace codec
+}  // namespace python
+}  // namespace roq
@@ -4,6 +4,10 @@
 
 #include <pybind11/pybind11.h>
 
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+
 #include "roq/codec/sbe/decoder.hpp"
 
 #include "roq/python/codec/sbe/details.hpp"
@@ -45,11 +49,45 @@ struct Decoder final {
   Decoder() : decoder_{roq::codec::sbe::Decoder::create()} {}
 
   template <typename Callback>
-  size_t dispatch(Callback const &callback, std::string_view const &message) {
+  size_t dispatch(Callback const &callback, std::span<std::byte const> const &buffer) {
+    Handler handler{callback};
+    return dispatch_helper(handler, buffer);
+  }
+
+  // note!
+  //   decodes many messages (e.g. a recvmmsg batch) from one buffer, i.e. a single crossing
+  //   returns the number of bytes decoded (summed over all messages)
+  template <typename Callback>
+  size_t dispatch_many(
+      Callback const &callback,
+      std::span<std::byte const> const &buffer,
+      std::span<int64_t const> const &offsets,
+      std::span<int64_t const> const &lengths) {
+    using namespace std::literals;
+    if (std::size(offsets) != std::size(lengths))
+      throw std::invalid_argument{"Offsets and lengths must have the same size"s};
+    // note! checked without adding offset and length (overflow)
+    for (size_t i = 0; i < std::size(offsets); ++i) {
+      if (offsets[i] < 0 || lengths[i] < 0)
+        throw std::out_of_range{"Message is out of range"s};
+      auto offset = static_cast<size_t>(offsets[i]), length = static_cast<size_t>(lengths[i]);
+      if (offset > std::size(buffer) || length > (std::size(buffer) - offset))
+        throw std::out_of_range{"Message is out of range"s};
+    }
+    Handler handler{callback};
+    size_t result = {};
+    for (size_t i = 0; i < std::size(offsets); ++i)
+      result += dispatch_helper(handler, buffer.subspan(offsets[i], lengths[i]));
+    return result;
+  }
+
+  // XXX HANS tuple
+
+ protected:
+  template <typename Callback>
+  size_t dispatch_helper(Handler<Callback> &handler, std::span<std::byte const> const &buffer) {
     size_t result = {};
     try {
-      Handler handler{callback};
-      std::span buffer{reinterpret_cast<std::byte const *>(std::data(message)), std::size(message)};
       result = (*decoder_)(handler, buffer);
     } catch (pybind11::error_already_set &) {
       /*
@@ -64,8 +102,6 @@ struct Decoder final {
     return result;
   }
 
-  // XXX HANS tuple
-
  private:
   std::unique_ptr<roq::codec::sbe::Decoder> decoder_;
 };
@@ -6,95 +6,226 @@
 
 #include <pybind11/chrono.h>
 #include <pybind11/functional.h>
+#include <pybind11/numpy.h>
 #include <pybind11/stl.h>
 
 #include "roq/python/utils.hpp"
 
 #include "roq/api.hpp"
 
+#include "roq/python/codec/sbe/batch.hpp"
 #include "roq/python/codec/sbe/decoder.hpp"
+#include "roq/python/codec/sbe/feed_handler.hpp"
+
+#include "roq/python/codec/udp/details.hpp"
 
 using namespace std::literals;
 
 namespace roq {
 namespace python {
 
-template <>
-void utils::create_struct<roq::python::codec::sbe::Encoder>(pybind11::module_ &module) {
+namespace {
+// note! events are passed by reference (no copies)
+template <typename T, typename Class>
+void create_encode(Class &class_, char const *name) {
   using value_type = roq::python::codec::sbe::Encoder;
-  std::string name{nameof::nameof_short_type<value_type>()};
-  pybind11::class_<value_type>(module, name.c_str())
-      .def(pybind11::init<>())
+  class_
       .def(
           "encode",
-          [](value_type &self, utils::Ref<MessageInfo> &message_info, utils::Ref<ReferenceData> &reference_data) {
-            auto message = self(static_cast<MessageInfo>(message_info), static_cast<ReferenceData>(reference_data));
+          [](value_type &self, utils::Ref<MessageInfo> const &message_info, utils::Ref<T> const &value) {
+            auto message = self(static_cast<MessageInfo const &>(message_info), static_cast<T const &>(value));
             std::string_view result{reinterpret_cast<char const *>(std::data(message)), std::size(message)};
             return pybind11::bytes{result};
           },
           pybind11::arg("message_info"),
-          pybind11::arg("reference_data"))
+          pybind11::arg(name))
       .def(
-          "encode",
-          [](value_type &self, utils::Ref<MessageInfo> &message_info, utils::Ref<MarketStatus> &market_status) {
-            auto message = self(static_cast<MessageInfo>(message_info), static_cast<MarketStatus>(market_status));
-            std::string_view result{reinterpret_cast<char const *>(std::data(message)), std::size(message)};
-            return pybind11::bytes{result};
+          "encode_into",
+          [](value_type &self,
+             utils::Ref<MessageInfo> const &message_info,
+             utils::Ref<T> const &value,
+             pybind11::buffer buffer,
+             size_t offset) {
+            auto info = buffer.request(true);
+            if (info.itemsize != 1 || info.ndim != 1 || info.strides[0] != 1)
+              throw std::invalid_argument{"Expected a contiguous byte buffer"s};
+            if (offset > static_cast<size_t>(info.size))
+              throw std::out_of_range{"Offset is out of range"s};
+            std::span destination{static_cast<std::byte *>(info.ptr) + offset, static_cast<size_t>(info.size) - offset};
+            return self.encode_into(
+                destination, static_cast<MessageInfo const &>(message_info), static_cast<T const &>(value));
           },
           pybind11::arg("message_info"),
-          pybind11::arg("market_status"))
+          pybind11::arg(name),
+          pybind11::arg("buffer"),
+          pybind11::arg("offset") = 0,
+          "Encode into a writable buffer (bytearray, memoryview, ...), returns number of bytes written");
+}
+
+template <typename T, typename Class>
+void create_append(Class &class_, char const *name) {
+  using value_type = roq::python::codec::sbe::Batch;
+  class_.def(
+      "append",
+      [](value_type &self,
+         utils::Ref<MessageInfo> const &message_info,
+         utils::Ref<T> const &value,
+         std::optional<uint64_t> const &last_sequence_number) {
+        self.append(
+            static_cast<MessageInfo const &>(message_info), static_cast<T const &>(value), last_sequence_number);
+      },
+      pybind11::arg("message_info"),
+      pybind11::arg(name),
+      pybind11::arg("last_sequence_number") = pybind11::none());
+}
+}  // namespace
+
+template <>
+void utils::create_struct<roq::python::codec::sbe::Encoder>(pybind11::module_ &module) {
+  using value_type = roq::python::codec::sbe::Encoder;
+  std::string name{nameof::nameof_short_type<value_type>()};
+  pybind11::class_<value_type> class_(module, name.c_str());
+  class_.def(pybind11::init<>());
+  create_encode<ReferenceData>(class_, "reference_data");
+  create_encode<MarketStatus>(class_, "market_status");
+  create_encode<TopOfBook>(class_, "top_of_book");
+  create_encode<MarketByPriceUpdate>(class_, "market_by_price_update");
+  create_encode<MarketByOrderUpdate>(class_, "market_by_order_update");
+  create_encode<TradeSummary>(class_, "trade_summary");
+  create_encode<StatisticsUpdate>(class_, "statistic_update");
+}
+
+template <>
+void utils::create_struct<roq::python::codec::sbe::Batch>(pybind11::module_ &module) {
+  using value_type = roq::python::codec::sbe::Batch;
+  std::string name{nameof::nameof_short_type<value_type>()};
+  pybind11::class_<value_type> class_(
+      module, name.c_str(), "Packs many encoded messages (optionally as udp datagrams) into one buffer");
+  class_
       .def(
-          "encode",
-          [](value_type &self, utils::Ref<MessageInfo> &message_info, utils::Ref<TopOfBook> &top_of_book) {
-            auto message = self(static_cast<MessageInfo>(message_info), static_cast<TopOfBook>(top_of_book));
-            std::string_view result{reinterpret_cast<char const *>(std::data(message)), std::size(message)};
-            return pybind11::bytes{result};
-          },
-          pybind11::arg("message_info"),
-          pybind11::arg("top_of_book"))
+          pybind11::init([](std::optional<roq::python::codec::udp::Header> const &header) {
+            std::optional<roq::codec::udp::Header> header_2;
+            if (header.has_value())
+              header_2 = static_cast<roq::codec::udp::Header>(*header);
+            return std::make_unique<value_type>(header_2);
+          }),
+          pybind11::arg("header") = pybind11::none())
+      .def("__len__", [](value_type const &self) { return self.size(); })
+      // note! copied (once per batch), a view would be invalidated by append and clear
       .def(
-          "encode",
-          [](value_type &self,
-             utils::Ref<MessageInfo> &message_info,
-             utils::Ref<MarketByPriceUpdate> &market_by_price_update) {
-            auto message =
-                self(static_cast<MessageInfo>(message_info), static_cast<MarketByPriceUpdate>(market_by_price_update));
-            std::string_view result{reinterpret_cast<char const *>(std::data(message)), std::size(message)};
-            return pybind11::bytes{result};
+          "data",
+          [](value_type const &self) {
+            auto data = self.data();
+            return pybind11::bytes{reinterpret_cast<char const *>(std::data(data)), std::size(data)};
           },
-          pybind11::arg("message_info"),
-          pybind11::arg("market_by_price_update"))
+          "All messages as one contiguous buffer (bytes)")
+      .def_property_readonly(
+          "offsets",
+          [](value_type const &self) {
+            auto offsets = self.offsets();
+            return pybind11::array_t<int64_t>(std::size(offsets), std::data(offsets));
+          })
+      .def_property_readonly(
+          "lengths",
+          [](value_type const &self) {
+            auto lengths = self.lengths();
+            return pybind11::array_t<int64_t>(std::size(lengths), std::data(lengths));
+          })
+      .def_property_readonly("sequence_number", [](value_type const &self) { return self.sequence_number(); })
+      .def("clear", [](value_type &self) { self.clear(); });
+  create_append<ReferenceData>(class_, "reference_data");
+  create_append<MarketStatus>(class_, "market_status");
+  create_append<TopOfBook>(class_, "top_of_book");
+  create_append<MarketByPriceUpdate>(class_, "market_by_price_update");
+  create_append<MarketByOrderUpdate>(class_, "market_by_order_update");
+  create_append<TradeSummary>(class_, "trade_summary");
+  create_append<StatisticsUpdate>(class_, "statistic_update");
+}
+
+template <>
+void utils::create_struct<roq::python::codec::sbe::FeedHandler>(pybind11::module_ &module) {
+  using value_type = roq::python::codec::sbe::FeedHandler;
+  std::string name{nameof::nameof_short_type<value_type>()};
+  pybind11::class_<value_type>(
+      module, name.c_str(), "Receives a SBE multicast feed (incremental + snapshot) and maintains order books")
       .def(
-          "encode",
-          [](value_type &self,
-             utils::Ref<MessageInfo> &message_info,
-             utils::Ref<MarketByOrderUpdate> &market_by_order_update) {
-            auto message =
-                self(static_cast<MessageInfo>(message_info), static_cast<MarketByOrderUpdate>(market_by_order_update));
-            std::string_view result{reinterpret_cast<char const *>(std::data(message)), std::size(message)};
-            return pybind11::bytes{result};
-          },
-          pybind11::arg("message_info"),
-          pybind11::arg("market_by_order_update"))
+          pybind11::init([](std::string_view const &local_interface,
+                            uint16_t snapshot_port,
+                            uint16_t incremental_port,
+                            std::string_view const &snapshot_address,
+                            std::string_view const &incremental_address,
+                            std::chrono::milliseconds timeout,
+                            size_t depth,
+                            size_t maximum_packet_size,
+                            size_t batch_size,
+                            size_t maximum_batches) {
+            auto options = value_type::Options{
+                .local_interface = std::string{local_interface},
+                .snapshot_address = std::string{snapshot_address},
+                .snapshot_port = snapshot_port,
+                .incremental_address = std::string{incremental_address},
+                .incremental_port = incremental_port,
+                .timeout = timeout,
+                .depth = depth,
+                .maximum_packet_size = maximum_packet_size,
+                .batch_size = batch_size,
+                .maximum_batches = maximum_batches,
+            };
+            return std::make_unique<value_type>(options);
+          }),
+          pybind11::arg("local_interface"),
+          pybind11::arg("snapshot_port"),
+          pybind11::arg("incremental_port"),
+          pybind11::arg("snapshot_address") = std::string_view{},
+          pybind11::arg("incremental_address") = std::string_view{},
+          pybind11::arg("timeout") = std::chrono::milliseconds{},
+          pybind11::arg("depth") = 8,
+          pybind11::arg("maximum_packet_size") = 4096,
+          pybind11::arg("batch_size") = 64,
+          pybind11::arg("maximum_batches") = 16)
+      .def_property_readonly("snapshot_fd", [](value_type const &self) { return self.snapshot_fd(); })
+      .def_property_readonly("incremental_fd", [](value_type const &self) { return self.incremental_fd(); })
+      .def_property_readonly("packets", [](value_type const &self) { return self.packets(); })
+      .def_property_readonly("bytes", [](value_type const &self) { return self.bytes(); })
+      .def_property_readonly("truncated", [](value_type const &self) { return self.truncated(); })
+      .def_property_readonly("resets", [](value_type const &self) { return self.resets(); })
+      // note!
+      //   python is only called with the changed instruments (reset is called first if the book was cleared)
+      //   the gil is held while datagrams are processed (the books are shared with python, e.g. book())
       .def(
-          "encode",
-          [](value_type &self, utils::Ref<MessageInfo> &message_info, utils::Ref<TradeSummary> &trade_summary) {
-            auto message = self(static_cast<MessageInfo>(message_info), static_cast<TradeSummary>(trade_summary));
-            std::string_view result{reinterpret_cast<char const *>(std::data(message)), std::size(message)};
-            return pybind11::bytes{result};
+          "poll",
+          [](value_type &self, pybind11::function const &update, size_t depth, pybind11::object const &reset) {
+            auto result = self.poll();
+            self.get_changed([&](auto &instrument, bool reset_2) {
+              if (reset_2 && !reset.is_none())
+                reset(instrument.exchange, instrument.symbol);
+              if (depth)
+                update(instrument.exchange, instrument.symbol, instrument.market_by_price.extract(depth));
+              else
+                update(instrument.exchange, instrument.symbol);
+            });
+            return result;
           },
-          pybind11::arg("message_info"),
-          pybind11::arg("trade_summary"))
+          pybind11::arg("update"),
+          pybind11::arg("depth") = 0,
+          pybind11::arg("reset") = pybind11::none(),
+          "Drain both sockets, update is called with (exchange, symbol) or (exchange, symbol, layers) if depth > 0, "
+          "reset (optional) is called with (exchange, symbol) when a book has been cleared")
       .def(
-          "encode",
-          [](value_type &self, utils::Ref<MessageInfo> &message_info, utils::Ref<StatisticsUpdate> &statistic_update) {
-            auto message =
-                self(static_cast<MessageInfo>(message_info), static_cast<StatisticsUpdate>(statistic_update));
-            std::string_view result{reinterpret_cast<char const *>(std::data(message)), std::size(message)};
-            return pybind11::bytes{result};
+          "book",
+          [](value_type &self, std::string_view const &exchange, std::string_view const &symbol) -> auto & {
+            return self.get(exchange, symbol).market_by_price;
           },
-          pybind11::arg("message_info"),
-          pybind11::arg("statistic_update"));
+          pybind11::arg("exchange"),
+          pybind11::arg("symbol"),
+          pybind11::return_value_policy::reference_internal)
+      .def_property_readonly("instruments", [](value_type const &self) {
+        pybind11::list result;
+        self.get_instruments([&](auto &instrument) {
+          result.append(pybind11::make_tuple(instrument.exchange, instrument.symbol));
+        });
+        return result;
+      });
 }
 
 template <>
@@ -108,9 +239,40 @@ void utils::create_struct<roq::python::codec::sbe::Decoder>(pybind11::module_ &m
           "dispatch",
           [](value_type &self,
              std::function<void(pybind11::object, pybind11::object)> &callback,
-             pybind11::bytes message) { return self.dispatch(callback, message); },
+             pybind11::buffer message) {
+            auto info = message.request();
+            if (info.itemsize != 1 || info.ndim != 1 || info.strides[0] != 1) {
+              using namespace std::literals;
+              throw std::invalid_argument{"Expected a contiguous byte buffer"s};
+            }
+            std::span buffer{static_cast<std::byte const *>(info.ptr), static_cast<size_t>(info.size)};
+            return self.dispatch(callback, buffer);
+          },
+          pybind11::arg("callback"),
+          pybind11::arg("message"),
+          "Decode a message (any contiguous byte buffer, e.g. bytes, bytearray or memoryview)")
+      .def(
+          "dispatch_many",
+          [](value_type &self,
+             std::function<void(pybind11::object, pybind11::object)> &callback,
+             pybind11::buffer buffer,
+             pybind11::array_t<int64_t, pybind11::array::c_style | pybind11::array::forcecast> const &offsets,
+             pybind11::array_t<int64_t, pybind11::array::c_style | pybind11::array::forcecast> const &lengths) {
+            auto info = buffer.request();
+            if (info.itemsize != 1 || info.ndim != 1 || info.strides[0] != 1) {
+              using namespace std::literals;
+              throw std::invalid_argument{"Expected a contiguous byte buffer"s};
+            }
+            std::span buffer_2{static_cast<std::byte const *>(info.ptr), static_cast<size_t>(info.size)};
+            std::span offsets_2{offsets.data(), static_cast<size_t>(offsets.size())};
+            std::span lengths_2{lengths.data(), static_cast<size_t>(lengths.size())};
+            return self.dispatch_many(callback, buffer_2, offsets_2, lengths_2);
+          },
           pybind11::arg("callback"),
-          pybind11::arg("message"));
+          pybind11::arg("buffer"),
+          pybind11::arg("offsets"),
+          pybind11::arg("lengths"),
+          "Decode many messages from one buffer, returns the total number of bytes decoded");
 }
 
 }  // namespace python
@@ -2,6 +2,10 @@
 
 #pragma once
 
+#include <cstring>
+#include <span>
+#include <stdexcept>
+
 #include "roq/codec/sbe/encoder.hpp"
 
 namespace roq {
@@ -17,6 +21,18 @@ struct Encoder final {
     return (*encoder_)(event);
   }
 
+  // note!
+  //   returns the number of bytes written
+  //   the native encoder only encodes into its own buffer, the message is therefore copied (no allocation)
+  size_t encode_into(std::span<std::byte> const &buffer, MessageInfo const &message_info, auto const &value) {
+    using namespace std::literals;
+    auto message = (*this)(message_info, value);
+    if (std::size(buffer) < std::size(message))
+      throw std::length_error{"Buffer is too small"s};
+    std::memcpy(std::data(buffer), std::data(message), std::size(message));
+    return std::size(message);
+  }
+
  private:
   std::unique_ptr<roq::codec::sbe::Encoder> encoder_;
 };
@@ -0,0 +1,303 @@
+/* Copyright (c) 2017-2024, Hans Erik Thrane */
+
+#pragma once
+
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+#include "roq/api.hpp"
+
+#include "roq/codec/sbe/decoder.hpp"
+
+#include "roq/codec/udp/header.hpp"
+
+#include "roq/python/market/mbp/details.hpp"
+#include "roq/python/market/mbp/sequence.hpp"
+
+#include "roq/python/codec/sbe/pipeline.hpp"
+
+namespace roq {
+namespace python {
+namespace codec {
+namespace sbe {
+
+// note!
+//   native receive pipeline for a SBE multicast feed (incremental + snapshot channels)
+//     socket => reorder buffer => fragment assembly => decoder => sequencer => order book
+//   sockets are non-blocking, i.e. poll() should be called when a socket is readable (e.g. asyncio add_reader)
+//   python is only notified with the instruments that changed (once per poll)
+//     reset means the book was cleared (e.g. a gap, the book is invalid until the next snapshot)
+//   each poll reads at most maximum_batches batches per socket (the readable socket will trigger another poll)
+//   truncated datagrams (larger than maximum_packet_size) are dropped
+//   an empty multicast address means plain udp (bound to the local interface)
+
+struct FeedHandler final {
+  struct Options final {
+    std::string local_interface;
+    std::string snapshot_address;
+    uint16_t snapshot_port = {};
+    std::string incremental_address;
+    uint16_t incremental_port = {};
+    std::chrono::milliseconds timeout = {};
+    size_t depth = 8;                    // reorder buffer
+    size_t maximum_packet_size = 4096;  // reorder buffer (and receive buffers)
+    size_t batch_size = 64;             // recvmmsg
+    size_t maximum_batches = 16;        // recvmmsg (per poll)
+  };
+
+  struct Instrument final {
+    Instrument(std::string_view const &exchange, std::string_view const &symbol, std::chrono::milliseconds timeout)
+        : exchange{exchange}, symbol{symbol}, market_by_price{exchange, symbol}, sequencer{timeout} {}
+
+    std::string const exchange;
+    std::string const symbol;
+    roq::python::market::mbp::MarketByPrice market_by_price;
+    roq::python::market::mbp::Sequencer sequencer;
+    bool changed = false;
+    bool reset = false;  // note! since the last notification
+    size_t resets = {};
+  };
+
+  explicit FeedHandler(Options const &options)
+      : options_{options}, snapshot_{*this, options_.snapshot_address, options_.snapshot_port},
+        incremental_{*this, options_.incremental_address, options_.incremental_port} {}
+
+  int snapshot_fd() const { return snapshot_.socket.fd; }
+  int incremental_fd() const { return incremental_.socket.fd; }
+
+  // note! reads from both sockets (bounded), returns the number of datagrams received
+  size_t poll() { return snapshot_.poll() + incremental_.poll(); }
+
+  // note! returns instruments changed since the last call, callback(instrument, reset)
+  template <typename Callback>
+  void get_changed(Callback callback) {
+    for (auto *instrument : changed_) {
+      auto reset = (*instrument).reset;
+      (*instrument).changed = false;
+      (*instrument).reset = false;
+      callback(*instrument, reset);
+    }
+    changed_.clear();
+  }
+
+  Instrument &get(std::string_view const &exchange, std::string_view const &symbol) {
+    using namespace std::literals;
+    auto iter = instruments_.find(exchange);
+    if (iter != std::end(instruments_)) {
+      auto &tmp = (*iter).second;
+      auto iter_2 = tmp.find(symbol);
+      if (iter_2 != std::end(tmp))
+        return (*iter_2).second;
+    }
+    throw pybind11::key_error{"Unknown instrument"s};
+  }
+
+  template <typename Callback>
+  void get_instruments(Callback callback) const {
+    for (auto &[_, tmp] : instruments_)
+      for (auto &[_, instrument] : tmp)
+        callback(instrument);
+  }
+
+  // statistics
+
+  size_t packets() const { return snapshot_.packets + incremental_.packets; }
+  size_t bytes() const { return snapshot_.bytes + incremental_.bytes; }
+  size_t truncated() const { return snapshot_.truncated + incremental_.truncated; }
+  size_t resets() const { return snapshot_.resets() + incremental_.resets(); }
+
+ protected:
+  struct Socket final {
+    Socket(std::string_view const &local_interface, std::string_view const &address, uint16_t port) {
+      using namespace std::literals;
+      fd = ::socket(AF_INET, SOCK_DGRAM | SOCK_NONBLOCK | SOCK_CLOEXEC, IPPROTO_UDP);
+      if (fd < 0)
+        throw std::system_error{errno, std::generic_category(), "socket"s};
+      try {
+        int enable = 1;
+        check(::setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &enable, sizeof(enable)), "setsockopt"sv);
+        check(::setsockopt(fd, SOL_SOCKET, SO_REUSEPORT, &enable, sizeof(enable)), "setsockopt"sv);
+        struct sockaddr_in addr = {};
+        addr.sin_family = AF_INET;
+        addr.sin_port = htons(port);
+        if (std::empty(address)) {
+          addr.sin_addr = to_in_addr(local_interface);
+        } else {
+          addr.sin_addr.s_addr = htonl(INADDR_ANY);
+        }
+        check(::bind(fd, reinterpret_cast<struct sockaddr const *>(&addr), sizeof(addr)), "bind"sv);
+        if (!std::empty(address)) {
+          struct ip_mreq mreq = {};
+          mreq.imr_multiaddr = to_in_addr(address);
+          mreq.imr_interface = to_in_addr(local_interface);
+          check(::setsockopt(fd, IPPROTO_IP, IP_ADD_MEMBERSHIP, &mreq, sizeof(mreq)), "setsockopt"sv);
+        }
+      } catch (...) {
+        ::close(fd);
+        throw;
+      }
+    }
+
+    Socket(Socket const &) = delete;
+
+    ~Socket() {
+      if (fd >= 0)
+        ::close(fd);
+    }
+
+    static void check(int result, std::string_view const &what) {
+      if (result < 0)
+        throw std::system_error{errno, std::generic_category(), std::string{what}};
+    }
+
+    static struct in_addr to_in_addr(std::string_view const &address) {
+      using namespace std::literals;
+      std::string address_2{address};
+      struct in_addr result = {};
+      if (::inet_pton(AF_INET, address_2.c_str(), &result) != 1)
+        throw std::invalid_argument{"Invalid ipv4 address"s};
+      return result;
+    }
+
+    int fd = -1;
+  };
+
+  struct Channel final : public roq::codec::sbe::Decoder::Handler {
+    Channel(FeedHandler &feed_handler, std::string_view const &address, uint16_t port)
+        : feed_handler{feed_handler}, socket{feed_handler.options_.local_interface, address, port},
+          pipeline{feed_handler.options_.depth, feed_handler.options_.maximum_packet_size} {
+      auto batch_size = feed_handler.options_.batch_size;
+      auto packet_size = feed_handler.options_.maximum_packet_size;
+      buffer.resize(batch_size * packet_size);
+      iovecs.resize(batch_size);
+      messages.resize(batch_size);
+      for (size_t i = 0; i < batch_size; ++i) {
+        iovecs[i] = {
+            .iov_base = std::data(buffer) + i * packet_size,
+            .iov_len = packet_size,
+        };
+        messages[i].msg_hdr = {};
+        messages[i].msg_hdr.msg_iov = &iovecs[i];
+        messages[i].msg_hdr.msg_iovlen = 1;
+      }
+    }
+
+    size_t poll() {
+      size_t result = {};
+      for (size_t batches = 0; batches < feed_handler.options_.maximum_batches;) {
+        auto count = ::recvmmsg(socket.fd, std::data(messages), std::size(messages), 0, nullptr);
+        if (count < 0) {
+          if (errno == EAGAIN || errno == EWOULDBLOCK)
+            break;
+          if (errno == EINTR)
+            continue;
+          using namespace std::literals;
+          throw std::system_error{errno, std::generic_category(), "recvmmsg"s};
+        }
+        ++batches;
+        for (int i = 0; i < count; ++i) {
+          auto &message = messages[i];
+          ++packets;
+          bytes += message.msg_len;
+          if (message.msg_hdr.msg_flags & MSG_TRUNC) {
+            ++truncated;
+            continue;
+          }
+          std::span datagram{static_cast<std::byte const *>(iovecs[i].iov_base), message.msg_len};
+          pipeline(*this, datagram);
+        }
+        result += count;
+        if (static_cast<size_t>(count) < std::size(messages))
+          break;
+      }
+      return result;
+    }
+
+    size_t resets() const { return pipeline.resets(); }
+
+    // codec::sbe::Decoder::Handler
+
+    void operator()(Event<ReferenceData> const &) override {}
+    void operator()(Event<MarketStatus> const &) override {}
+    void operator()(Event<TopOfBook> const &) override {}
+    void operator()(Event<MarketByPriceUpdate> const &event) override { feed_handler(event.value, pipeline.header()); }
+    void operator()(Event<MarketByOrderUpdate> const &) override {}
+    void operator()(Event<TradeSummary> const &) override {}
+    void operator()(Event<StatisticsUpdate> const &) override {}
+
+    FeedHandler &feed_handler;
+    Socket socket;
+    Pipeline pipeline;
+    std::vector<std::byte> buffer;
+    std::vector<struct iovec> iovecs;
+    std::vector<struct mmsghdr> messages;
+    size_t packets = {};
+    size_t bytes = {};
+    size_t truncated = {};
+  };
+
+  // note! same logic as market::mbp::Sequencer.apply (python)
+  void operator()(MarketByPriceUpdate const &market_by_price_update, roq::codec::udp::Header const &header) {
+    auto &instrument = get_or_create(market_by_price_update.exchange, market_by_price_update.symbol);
+    auto publish = [&](auto &bids, auto &asks, auto update_type) {
+      auto result = market_by_price_update;
+      result.bids = bids;
+      result.asks = asks;
+      result.update_type = update_type;
+      instrument.market_by_price(result);
+      mark_changed(instrument);
+    };
+    auto reset = [&]([[maybe_unused]] auto retries) {
+      ++instrument.resets;
+      instrument.market_by_price.clear();
+      instrument.reset = true;
+      mark_changed(instrument);
+    };
+    roq::python::market::mbp::sequence(instrument.sequencer.sequencer, market_by_price_update, header, publish, reset);
+  }
+
+  void mark_changed(Instrument &instrument) {
+    if (instrument.changed)
+      return;
+    instrument.changed = true;
+    changed_.emplace_back(&instrument);
+  }
+
+  Instrument &get_or_create(std::string_view const &exchange, std::string_view const &symbol) {
+    auto iter = instruments_.find(exchange);
+    if (iter == std::end(instruments_))
+      iter = instruments_.try_emplace(std::string{exchange}).first;
+    auto &tmp = (*iter).second;
+    auto iter_2 = tmp.find(symbol);
+    if (iter_2 == std::end(tmp))
+      iter_2 = tmp.try_emplace(std::string{symbol}, exchange, symbol, options_.timeout).first;
+    return (*iter_2).second;
+  }
+
+ private:
+  Options const options_;
+  std::map<std::string, std::map<std::string, Instrument, std::less<>>, std::less<>> instruments_;
+  std::vector<Instrument *> changed_;
+  Channel snapshot_;
+  Channel incremental_;
+};
+
+}  // namespace sbe
+}  // namespace codec
+}  // namespace python
+}  // namespace roq
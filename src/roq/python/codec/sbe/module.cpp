@@ -10,8 +10,11 @@
 
 #include "roq/python/utils.hpp"
 
+#include "roq/python/codec/sbe/batch.hpp"
 #include "roq/python/codec/sbe/decoder.hpp"
 #include "roq/python/codec/sbe/encoder.hpp"
+#include "roq/python/codec/sbe/feed_handler.hpp"
+#include "roq/python/codec/sbe/replay.hpp"
 
 using namespace std::literals;
 
@@ -23,6 +26,19 @@ namespace sbe {
 void Module::create(pybind11::module_ &module) {
   utils::create_struct<roq::python::codec::sbe::Decoder>(module);
   utils::create_struct<roq::python::codec::sbe::Encoder>(module);
+  utils::create_struct<roq::python::codec::sbe::Batch>(module);
+  utils::create_struct<roq::python::codec::sbe::FeedHandler>(module);
+
+  module.def(
+      "replay",
+      &roq::python::codec::sbe::replay,
+      pybind11::arg("path"),
+      pybind11::arg("callback") = pybind11::none(),
+      pybind11::arg("ports") = std::vector<uint16_t>{},
+      pybind11::arg("speed") = 0.0,
+      pybind11::arg("depth") = 8,
+      pybind11::arg("maximum_packet_size") = 4096,
+      "Replay a capture file (pcap or pcapng) through reorder buffer and decoder, returns statistics");
 }
 
 }  // namespace sbe
@@ -0,0 +1,88 @@
+/* Copyright (c) 2017-2024, Hans Erik Thrane */
+
+#pragma once
+
+#include <limits>
+#include <memory>
+#include <span>
+
+#include "roq/codec/sbe/decoder.hpp"
+
+#include "roq/codec/udp/decoder.hpp"
+#include "roq/codec/udp/header.hpp"
+
+#include "roq/io/net/reorder_buffer.hpp"
+
+#include "roq/python/codec/udp/reassembler.hpp"
+
+namespace roq {
+namespace python {
+namespace codec {
+namespace sbe {
+
+// note!
+//   datagram => reorder buffer => fragment assembly => decoder
+//   header() is the udp header of the datagram currently being decoded (valid during the handler callbacks)
+//   re-joining in the middle of a fragmented message (e.g. after packet loss) drops the message
+//   fragments are reassembled per (session_id, object_id) into pre-allocated slots
+
+struct Pipeline final : public roq::io::net::ReorderBuffer::Handler {
+  Pipeline(
+      size_t depth, size_t maximum_packet_size, roq::python::codec::udp::Reassembler::Options const &reassembler = {})
+      : reorder_buffer_{roq::io::net::ReorderBuffer::create(roq::io::net::ReorderBuffer::Options{
+            .depth = depth,
+            .maximum_packet_size = maximum_packet_size,
+            .maximum_sequence_number = std::numeric_limits<uint64_t>::max(),
+            .minimum_sequence_number = {},
+        })},
+        reassembler_{reassembler}, decoder_{roq::codec::sbe::Decoder::create()} {}
+
+  Pipeline(Pipeline const &) = delete;
+
+  // note! returns false if the datagram is too small to contain a udp header
+  bool operator()(roq::codec::sbe::Decoder::Handler &handler, std::span<std::byte const> const &datagram) {
+    if (std::size(datagram) < sizeof(roq::codec::udp::Header))
+      return false;
+    handler_ = &handler;
+    sequence_number_ = roq::codec::udp::Decoder::get_sequence_number(datagram);
+    (*reorder_buffer_).dispatch(*this, datagram);
+    handler_ = nullptr;
+    return true;
+  }
+
+  roq::codec::udp::Header const &header() const { return header_; }
+
+  size_t resets() const { return resets_; }
+
+  roq::python::codec::udp::Reassembler const &reassembler() const { return reassembler_; }
+
+ protected:
+  // io::net::ReorderBuffer::Handler
+
+  uint64_t operator()(roq::io::net::ReorderBuffer::GetSequenceNumber const &) override { return sequence_number_; }
+
+  void operator()(roq::io::net::ReorderBuffer::Parse const &parse) override {
+    roq::codec::udp::Decoder::decode(header_, parse.payload);
+    auto payload = parse.payload.subspan(sizeof(roq::codec::udp::Header));
+    reassembler_(header_, payload, [&](auto &, auto &message) { (*decoder_)(*handler_, message); });
+  }
+
+  void operator()(roq::io::net::ReorderBuffer::Reset const &) override {
+    ++resets_;
+    reassembler_.clear();
+  }
+
+ private:
+  std::unique_ptr<roq::io::net::ReorderBuffer> reorder_buffer_;
+  roq::python::codec::udp::Reassembler reassembler_;
+  std::unique_ptr<roq::codec::sbe::Decoder> decoder_;
+  roq::codec::sbe::Decoder::Handler *handler_ = nullptr;
+  uint64_t sequence_number_ = {};
+  roq::codec::udp::Header header_ = {};
+  size_t resets_ = {};
+};
+
+}  // namespace sbe
+}  // namespace codec
+}  // namespace python
+}  // namespace roq
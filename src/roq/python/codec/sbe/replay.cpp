@@ -0,0 +1,132 @@
+/* Copyright (c) 2017-2024, Hans Erik Thrane */
+
+#define PYBIND11_DETAILED_ERROR_MESSAGES
+
+#include "roq/python/codec/sbe/replay.hpp"
+
+#include <pybind11/chrono.h>
+
+#include <chrono>
+#include <map>
+#include <stdexcept>
+#include <thread>
+
+#include "roq/python/codec/sbe/decoder.hpp"
+#include "roq/python/codec/sbe/pipeline.hpp"
+
+#include "roq/python/io/pcap/reader.hpp"
+
+using namespace std::literals;
+
+namespace roq {
+namespace python {
+namespace codec {
+namespace sbe {
+
+namespace {
+struct Noop final : public roq::codec::sbe::Decoder::Handler {
+  void operator()(Event<ReferenceData> const &) override {}
+  void operator()(Event<MarketStatus> const &) override {}
+  void operator()(Event<TopOfBook> const &) override {}
+  void operator()(Event<MarketByPriceUpdate> const &) override {}
+  void operator()(Event<MarketByOrderUpdate> const &) override {}
+  void operator()(Event<TradeSummary> const &) override {}
+  void operator()(Event<StatisticsUpdate> const &) override {}
+};
+
+struct Replay final {
+  Replay(std::string_view const &path, double speed, size_t depth, size_t maximum_packet_size)
+      : reader_{path}, speed_{speed}, depth_{depth}, maximum_packet_size_{maximum_packet_size} {}
+
+  // note! sleep is called (with the target time) when pacing
+  template <typename Sleep>
+  void operator()(roq::codec::sbe::Decoder::Handler &handler, std::vector<uint16_t> const &ports, Sleep sleep) {
+    auto start = std::chrono::steady_clock::now();
+    std::chrono::nanoseconds first = {};
+    reader_.dispatch(
+        [&](auto &packet) {
+          if (speed_ > 0.0) {
+            if (!packets_)
+              first = packet.timestamp;
+            auto offset = static_cast<double>((packet.timestamp - first).count());
+            std::chrono::duration<double, std::nano> delay{offset / speed_};
+            auto target = start + std::chrono::duration_cast<std::chrono::nanoseconds>(delay);
+            if (std::chrono::steady_clock::now() < target)
+              sleep(target);
+          }
+          ++packets_;
+          bytes_ += std::size(packet.payload);
+          auto &pipeline = get_pipeline(packet.destination_port);
+          if (!pipeline(handler, packet.payload))
+            ++invalid_;
+        },
+        ports);
+    elapsed_ = std::chrono::steady_clock::now() - start;
+  }
+
+  pybind11::dict statistics() const {
+    size_t resets = {}, dropped = {};
+    for (auto &[_, pipeline] : pipelines_) {
+      resets += pipeline.resets();
+      dropped += pipeline.reassembler().dropped();
+    }
+    pybind11::dict result;
+    result["packets"] = packets_;
+    result["bytes"] = bytes_;
+    result["skipped"] = reader_.skipped() + invalid_;
+    result["resets"] = resets;
+    result["dropped"] = dropped;
+    result["elapsed"] = std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed_);
+    return result;
+  }
+
+ protected:
+  // note! sequence numbers are per channel
+  Pipeline &get_pipeline(uint16_t port) {
+    auto iter = pipelines_.find(port);
+    if (iter == std::end(pipelines_))
+      iter = pipelines_.try_emplace(port, depth_, maximum_packet_size_).first;
+    return (*iter).second;
+  }
+
+ private:
+  roq::python::io::pcap::Reader reader_;
+  double const speed_;
+  size_t const depth_;
+  size_t const maximum_packet_size_;
+  std::map<uint16_t, Pipeline> pipelines_;
+  size_t packets_ = {};
+  size_t bytes_ = {};
+  size_t invalid_ = {};
+  std::chrono::steady_clock::duration elapsed_ = {};
+};
+}  // namespace
+
+pybind11::dict replay(
+    std::string_view const &path,
+    pybind11::object const &callback,
+    std::vector<uint16_t> const &ports,
+    double speed,
+    size_t depth,
+    size_t maximum_packet_size) {
+  if (speed < 0.0)
+    throw std::invalid_argument{"Speed must not be negative"s};
+  Replay replay{path, speed, depth, maximum_packet_size};
+  if (callback.is_none()) {
+    pybind11::gil_scoped_release release;
+    Noop handler;
+    replay(handler, ports, [](auto target) { std::this_thread::sleep_until(target); });
+  } else {
+    Decoder::Handler handler{callback};
+    replay(handler, ports, [](auto target) {
+      pybind11::gil_scoped_release release;
+      std::this_thread::sleep_until(target);
+    });
+  }
+  return replay.statistics();
+}
+
+}  // namespace sbe
+}  // namespace codec
+}  // namespace python
+}  // namespace roq
@@ -0,0 +1,35 @@
+/* Copyright (c) 2017-2024, Hans Erik Thrane */
+
+#pragma once
+
+#include <pybind11/pybind11.h>
+
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace roq {
+namespace python {
+namespace codec {
+namespace sbe {
+
+// note!
+//   replays a capture file (pcap or pcapng) through the receive pipeline, i.e. reorder buffer => fragment assembly
+//   => decoder, one pipeline per destination port
+//   callback is called with (message_info, value), same as Decoder.dispatch
+//   a missing callback only decodes (the gil is released), useful for profiling the native pipeline
+//   speed is relative to the capture timestamps, 0 means as fast as possible
+//   returns {packets, bytes, skipped, resets, dropped, elapsed}, dropped is incomplete (fragmented) messages
+
+pybind11::dict replay(
+    std::string_view const &path,
+    pybind11::object const &callback,
+    std::vector<uint16_t> const &ports,
+    double speed,
+    size_t depth,
+    size_t maximum_packet_size);
+
+}  // namespace sbe
+}  // namespace codec
+}  // namespace python
+}  // namespace roq
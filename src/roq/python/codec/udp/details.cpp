@@ -13,6 +13,8 @@
 #include "roq/codec/udp/decoder.hpp"
 #include "roq/codec/udp/header.hpp"
 
+#include "roq/python/codec/udp/reassembler.hpp"
+
 using namespace std::literals;
 
 namespace roq {
@@ -66,5 +68,48 @@ void utils::create_struct<roq::python::codec::udp::Header>(pybind11::module_ &mo
       });
 }
 
+template <>
+void utils::create_struct<roq::python::codec::udp::Reassembler>(pybind11::module_ &module) {
+  using value_type = roq::python::codec::udp::Reassembler;
+  std::string name{nameof::nameof_short_type<value_type>()};
+  pybind11::class_<value_type>(module, name.c_str(), "Reassembles fragmented messages (bounded, pre-allocated)")
+      .def(
+          pybind11::init([](size_t maximum_objects, size_t maximum_message_size) {
+            auto options = value_type::Options{
+                .maximum_objects = maximum_objects,
+                .maximum_message_size = maximum_message_size,
+            };
+            return std::make_unique<value_type>(options);
+          }),
+          pybind11::arg("maximum_objects") = 8,
+          pybind11::arg("maximum_message_size") = 262144)
+      .def_property_readonly("completed", [](value_type const &self) { return self.completed(); })
+      .def_property_readonly("dropped", [](value_type const &self) { return self.dropped(); })
+      .def_property_readonly("in_flight", [](value_type const &self) { return self.in_flight(); })
+      .def("clear", [](value_type &self) { self.clear(); })
+      // note! the payload is copied (bytes), a view would point into the slab (overwritten by the next message)
+      .def(
+          "dispatch",
+          [](value_type &self, pybind11::buffer message, pybind11::function const &callback) {
+            auto info = message.request();
+            if (info.itemsize != 1 || info.ndim != 1 || info.strides[0] != 1)
+              throw std::invalid_argument{"Expected a contiguous byte buffer"s};
+            std::span buffer{static_cast<std::byte const *>(info.ptr), static_cast<size_t>(info.size)};
+            if (std::size(buffer) < sizeof(roq::codec::udp::Header))
+              throw std::invalid_argument{"Message is too small"s};
+            roq::codec::udp::Header header;
+            roq::codec::udp::Decoder::decode(header, buffer);
+            auto payload = buffer.subspan(sizeof(roq::codec::udp::Header));
+            self(header, payload, [&](auto &header, auto &payload) {
+              auto arg0 = pybind11::cast(roq::python::codec::udp::Header{header});
+              pybind11::bytes arg1{reinterpret_cast<char const *>(std::data(payload)), std::size(payload)};
+              callback(arg0, arg1);
+            });
+          },
+          pybind11::arg("message"),
+          pybind11::arg("callback"),
+          "Message includes the udp header, callback is called with (header, payload) when a message is complete");
+}
+
 }  // namespace python
 }  // namespace roq
@@ -11,6 +11,8 @@
 #include "roq/python/utils.hpp"
 
 #include "roq/python/codec/udp/details.hpp"
+#include "roq/python/codec/udp/parse_headers.hpp"
+#include "roq/python/codec/udp/reassembler.hpp"
 
 using namespace std::literals;
 
@@ -24,6 +26,14 @@ void Module::create(pybind11::module_ &module) {
   utils::create_enum<roq::codec::udp::Channel>(module);
 
   utils::create_struct<roq::python::codec::udp::Header>(module);
+  utils::create_struct<roq::python::codec::udp::Reassembler>(module);
+
+  module.def(
+      "parse_headers",
+      &roq::python::codec::udp::parse_headers,
+      pybind11::arg("buffer"),
+      pybind11::arg("offsets"),
+      "Decode many udp headers from one buffer, returns {field: array}");
 }
 
 }  // namespace udp
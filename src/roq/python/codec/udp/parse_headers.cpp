@@ -0,0 +1,101 @@
+/* Copyright (c) 2017-2024, Hans Erik Thrane */
+
+#define PYBIND11_DETAILED_ERROR_MESSAGES
+
+#include "roq/python/codec/udp/parse_headers.hpp"
+
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "roq/codec/udp/decoder.hpp"
+#include "roq/codec/udp/header.hpp"
+
+using namespace std::literals;
+
+namespace roq {
+namespace python {
+namespace codec {
+namespace udp {
+
+namespace {
+// note! numpy dtype follows the header field (enums use the underlying type)
+template <typename T>
+using column_type =
+    typename std::conditional<std::is_enum<T>::value, std::underlying_type<T>, std::type_identity<T>>::type::type;
+
+template <typename T>
+auto create_column(T roq::codec::udp::Header::*, pybind11::ssize_t size) {
+  return pybind11::array_t<column_type<typename std::remove_cvref<T>::type>>(size);
+}
+
+template <typename T>
+auto to_column(T value) {
+  if constexpr (std::is_enum<T>::value)
+    return std::to_underlying(value);
+  else
+    return value;
+}
+}  // namespace
+
+pybind11::dict parse_headers(
+    pybind11::buffer const &buffer,
+    pybind11::array_t<int64_t, pybind11::array::c_style | pybind11::array::forcecast> const &offsets) {
+  auto info = buffer.request();
+  if (info.itemsize != 1 || info.ndim != 1 || info.strides[0] != 1)
+    throw std::invalid_argument{"Expected a contiguous byte buffer"s};
+  std::span buffer_2{static_cast<std::byte const *>(info.ptr), static_cast<size_t>(info.size)};
+  std::span offsets_2{offsets.data(), static_cast<size_t>(offsets.size())};
+  for (auto offset : offsets_2)
+    if (offset < 0 || (static_cast<size_t>(offset) + sizeof(roq::codec::udp::Header)) > std::size(buffer_2))
+      throw std::out_of_range{"Offset is out of range"s};
+  auto size = static_cast<pybind11::ssize_t>(std::size(offsets_2));
+  using header_type = roq::codec::udp::Header;
+  auto control = create_column(&header_type::control, size);
+  auto object_type = create_column(&header_type::object_type, size);
+  auto session_id = create_column(&header_type::session_id, size);
+  auto sequence_number = create_column(&header_type::sequence_number, size);
+  auto fragment = create_column(&header_type::fragment, size);
+  auto fragment_max = create_column(&header_type::fragment_max, size);
+  auto object_id = create_column(&header_type::object_id, size);
+  auto last_sequence_number = create_column(&header_type::last_sequence_number, size);
+  {
+    auto control_2 = control.mutable_data();
+    auto object_type_2 = object_type.mutable_data();
+    auto session_id_2 = session_id.mutable_data();
+    auto sequence_number_2 = sequence_number.mutable_data();
+    auto fragment_2 = fragment.mutable_data();
+    auto fragment_max_2 = fragment_max.mutable_data();
+    auto object_id_2 = object_id.mutable_data();
+    auto last_sequence_number_2 = last_sequence_number.mutable_data();
+    pybind11::gil_scoped_release release;
+    for (size_t i = 0; i < std::size(offsets_2); ++i) {
+      header_type header;
+      roq::codec::udp::Decoder::decode(header, buffer_2.subspan(offsets_2[i]));
+      control_2[i] = to_column(header.control);
+      object_type_2[i] = to_column(header.object_type);
+      session_id_2[i] = to_column(header.session_id);
+      sequence_number_2[i] = to_column(header.sequence_number);
+      fragment_2[i] = to_column(header.fragment);
+      fragment_max_2[i] = to_column(header.fragment_max);
+      object_id_2[i] = to_column(header.object_id);
+      last_sequence_number_2[i] = to_column(header.last_sequence_number);
+    }
+  }
+  pybind11::dict result;
+  result["control"] = control;
+  result["object_type"] = object_type;
+  result["session_id"] = session_id;
+  result["sequence_number"] = sequence_number;
+  result["fragment"] = fragment;
+  result["fragment_max"] = fragment_max;
+  result["object_id"] = object_id;
+  result["last_sequence_number"] = last_sequence_number;
+  return result;
+}
+
+}  // namespace udp
+}  // namespace codec
+}  // namespace python
+}  // namespace roq
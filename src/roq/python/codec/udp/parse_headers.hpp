@@ -0,0 +1,26 @@
+/* Copyright (c) 2017-2024, Hans Erik Thrane */
+
+#pragma once
+
+#include <pybind11/numpy.h>
+#include <pybind11/pybind11.h>
+
+namespace roq {
+namespace python {
+namespace codec {
+namespace udp {
+
+// note!
+//   decodes many udp headers from one buffer (e.g. a recvmmsg batch or a capture)
+//   offsets are to the start of each header
+//   returns {field: numpy array}, one array per header field (control, object_type, session_id, sequence_number,
+//   fragment, fragment_max, object_id, last_sequence_number)
+
+pybind11::dict parse_headers(
+    pybind11::buffer const &buffer,
+    pybind11::array_t<int64_t, pybind11::array::c_style | pybind11::array::forcecast> const &offsets);
+
+}  // namespace udp
+}  // namespace codec
+}  // namespace python
+}  // namespace roq
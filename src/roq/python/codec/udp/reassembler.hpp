@@ -0,0 +1,156 @@
+/* Copyright (c) 2017-2024, Hans Erik Thrane */
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#include "roq/codec/udp/header.hpp"
+
+namespace roq {
+namespace python {
+namespace codec {
+namespace udp {
+
+// note!
+//   reassembles fragmented messages (fragment, fragment_max) keyed by (session_id, object_id)
+//   storage is a single slab allocated up front, i.e. a bounded number of messages can be in-flight
+//   fragments must arrive in order (e.g. after the reorder buffer), a missing fragment drops the message
+//   when all slots are in use, the least recently used message is dropped
+//   the payload passed to the callback is only valid during the callback
+
+struct Reassembler final {
+  struct Options final {
+    size_t maximum_objects = 8;
+    size_t maximum_message_size = 262144;
+  };
+
+  explicit Reassembler(Options const &options) : options_{options} {
+    using namespace std::literals;
+    if (!options_.maximum_objects || !options_.maximum_message_size)
+      throw std::invalid_argument{"Invalid options"s};
+    slab_.resize(options_.maximum_objects * options_.maximum_message_size);
+    slots_.resize(options_.maximum_objects);
+  }
+
+  Reassembler(Reassembler const &) = delete;
+
+  // note! callback(header, payload) where header is the header of the last fragment
+  template <typename Callback>
+  void operator()(roq::codec::udp::Header const &header, std::span<std::byte const> const &payload, Callback callback) {
+    if (header.fragment_max == 0) {
+      ++completed_;
+      callback(header, payload);
+      return;
+    }
+    auto *slot = find(header);
+    if (header.fragment == 0) {
+      if (slot != nullptr)
+        release(*slot, true);  // note! previous message was never completed
+      slot = &allocate(header);
+    } else if (slot == nullptr) {
+      ++dropped_;  // note! joined in the middle of a message
+      return;
+    }
+    auto &slot_2 = *slot;
+    if (header.fragment != slot_2.next_fragment || (slot_2.size + std::size(payload)) > options_.maximum_message_size) {
+      release(slot_2, true);
+      return;
+    }
+    auto data = std::data(slab_) + index(slot_2) * options_.maximum_message_size;
+    std::memcpy(data + slot_2.size, std::data(payload), std::size(payload));
+    slot_2.size += std::size(payload);
+    slot_2.last_used = ++clock_;
+    if (header.fragment == header.fragment_max) {
+      std::span<std::byte const> message{data, slot_2.size};
+      // note! released before the callback (the slab is not touched until the next call)
+      release(slot_2, false);
+      ++completed_;
+      callback(header, message);
+    } else {
+      ++slot_2.next_fragment;
+    }
+  }
+
+  // note! drops all in-flight messages (e.g. after a reset of the reorder buffer)
+  void clear() {
+    for (auto &slot : slots_)
+      if (slot.active)
+        release(slot, true);
+  }
+
+  size_t completed() const { return completed_; }
+  size_t dropped() const { return dropped_; }
+
+  size_t in_flight() const {
+    size_t result = {};
+    for (auto &slot : slots_)
+      if (slot.active)
+        ++result;
+    return result;
+  }
+
+ protected:
+  struct Slot final {
+    bool active = false;
+    uint16_t session_id = {};
+    uint16_t object_id = {};
+    uint8_t next_fragment = {};
+    size_t size = {};
+    uint64_t last_used = {};
+  };
+
+  Slot *find(roq::codec::udp::Header const &header) {
+    for (auto &slot : slots_)
+      if (slot.active && slot.session_id == header.session_id && slot.object_id == header.object_id)
+        return &slot;
+    return nullptr;
+  }
+
+  Slot &allocate(roq::codec::udp::Header const &header) {
+    Slot *result = nullptr;
+    for (auto &slot : slots_) {
+      if (!slot.active) {
+        result = &slot;
+        break;
+      }
+      if (result == nullptr || slot.last_used < (*result).last_used)
+        result = &slot;
+    }
+    if ((*result).active)
+      release(*result, true);
+    *result = {
+        .active = true,
+        .session_id = header.session_id,
+        .object_id = header.object_id,
+        .next_fragment = 0,
+        .size = 0,
+        .last_used = ++clock_,
+    };
+    return *result;
+  }
+
+  void release(Slot &slot, bool dropped) {
+    slot.active = false;
+    if (dropped)
+      ++dropped_;
+  }
+
+  size_t index(Slot const &slot) const { return &slot - std::data(slots_); }
+
+ private:
+  Options const options_;
+  std::vector<std::byte> slab_;
+  std::vector<Slot> slots_;
+  uint64_t clock_ = {};
+  size_t completed_ = {};
+  size_t dropped_ = {};
+};
+
+}  // namespace udp
+}  // namespace codec
+}  // namespace python
+}  // namespace roq
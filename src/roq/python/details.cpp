@@ -5,14 +5,31 @@
 #include "roq/python/details.hpp"
 
 #include <pybind11/chrono.h>
+#include <pybind11/numpy.h>
+#include <pybind11/stl.h>
 
+#include "roq/python/fields.hpp"
+#include "roq/python/histogram.hpp"
 #include "roq/python/utils.hpp"
+#include "roq/python/view.hpp"
 
 namespace roq {
 namespace python {
 
 // helpers
 
+template <>
+struct utils::Fields<roq::Fill> final {
+  template <typename Callback>
+  static void apply(roq::Fill const &value, Callback &&callback) {
+    using namespace std::literals;
+    callback("external_trade_id"sv, value.external_trade_id);
+    callback("quantity"sv, value.quantity);
+    callback("price"sv, value.price);
+    callback("liquidity"sv, value.liquidity);
+  }
+};
+
 template <>
 void utils::create_struct<roq::Fill>(pybind11::module_ &module) {
   using value_type = roq::Fill;
@@ -22,13 +39,27 @@ void utils::create_struct<roq::Fill>(pybind11::module_ &module) {
       .def_property_readonly("quantity", [](value_type const &value) { return value.quantity; })
       .def_property_readonly("price", [](value_type const &value) { return value.price; })
       .def_property_readonly("liquidity", [](value_type const &value) { return value.liquidity; })
+      .def("astuple", &utils::astuple<value_type>)
+      .def("asdict", &utils::asdict<value_type>)
+      .def("write_into", &utils::write_into<value_type>, pybind11::arg("array").noconvert(), pybind11::arg("row"))
       .def("__repr__", [](value_type const &value) {
         using namespace std::literals;
         return fmt::format("{}"sv, value);
       });
 }
 
-// XXX it would be very convenient here to return tuple for unpack
+template <>
+struct utils::Fields<roq::Layer> final {
+  template <typename Callback>
+  static void apply(roq::Layer const &value, Callback &&callback) {
+    using namespace std::literals;
+    callback("bid_price"sv, value.bid_price);
+    callback("bid_quantity"sv, value.bid_quantity);
+    callback("ask_price"sv, value.ask_price);
+    callback("ask_quantity"sv, value.ask_quantity);
+  }
+};
+
 template <>
 void utils::create_struct<roq::Layer>(pybind11::module_ &module) {
   using value_type = roq::Layer;
@@ -38,17 +69,29 @@ void utils::create_struct<roq::Layer>(pybind11::module_ &module) {
       .def_property_readonly("bid_quantity", [](value_type const &value) { return value.bid_quantity; })
       .def_property_readonly("ask_price", [](value_type const &value) { return value.ask_price; })
       .def_property_readonly("ask_quantity", [](value_type const &value) { return value.ask_quantity; })
-      .def(
-          "astuple",
-          [](value_type const &value) {
-            return pybind11::make_tuple(value.bid_price, value.bid_quantity, value.ask_price, value.ask_quantity);
-          })
+      .def("astuple", &utils::astuple<value_type>)
+      .def("asdict", &utils::asdict<value_type>)
+      .def("write_into", &utils::write_into<value_type>, pybind11::arg("array").noconvert(), pybind11::arg("row"))
       .def("__repr__", [](value_type const &value) {
         using namespace std::literals;
         return fmt::format("{}"sv, value);
       });
 }
 
+template <>
+struct utils::Fields<roq::MBPUpdate> final {
+  template <typename Callback>
+  static void apply(roq::MBPUpdate const &value, Callback &&callback) {
+    using namespace std::literals;
+    callback("price"sv, value.price);
+    callback("quantity"sv, value.quantity);
+    callback("implied_quantity"sv, value.implied_quantity);
+    callback("number_of_orders"sv, value.number_of_orders);
+    callback("update_action"sv, value.update_action);
+    callback("price_level"sv, value.price_level);
+  }
+};
+
 template <>
 void utils::create_struct<roq::MBPUpdate>(pybind11::module_ &module) {
   using value_type = roq::MBPUpdate;
@@ -60,12 +103,30 @@ void utils::create_struct<roq::MBPUpdate>(pybind11::module_ &module) {
       .def_property_readonly("number_of_orders", [](value_type const &value) { return value.number_of_orders; })
       .def_property_readonly("update_action", [](value_type const &value) { return value.update_action; })
       .def_property_readonly("price_level", [](value_type const &value) { return value.price_level; })
+      .def("astuple", &utils::astuple<value_type>)
+      .def("asdict", &utils::asdict<value_type>)
+      .def("write_into", &utils::write_into<value_type>, pybind11::arg("array").noconvert(), pybind11::arg("row"))
       .def("__repr__", [](value_type const &value) {
         using namespace std::literals;
         return fmt::format("{}"sv, value);
       });
 }
 
+template <>
+struct utils::Fields<roq::MBOUpdate> final {
+  template <typename Callback>
+  static void apply(roq::MBOUpdate const &value, Callback &&callback) {
+    using namespace std::literals;
+    callback("price"sv, value.price);
+    callback("quantity"sv, value.quantity);
+    callback("priority"sv, value.priority);
+    callback("order_id"sv, value.order_id);
+    callback("side"sv, value.side);
+    callback("action"sv, value.action);
+    callback("reason"sv, value.reason);
+  }
+};
+
 template <>
 void utils::create_struct<roq::MBOUpdate>(pybind11::module_ &module) {
   using value_type = roq::MBOUpdate;
@@ -78,12 +139,25 @@ void utils::create_struct<roq::MBOUpdate>(pybind11::module_ &module) {
       .def_property_readonly("side", [](value_type const &value) { return value.side; })
       .def_property_readonly("action", [](value_type const &value) { return value.action; })
       .def_property_readonly("reason", [](value_type const &value) { return value.reason; })
+      .def("astuple", &utils::astuple<value_type>)
+      .def("asdict", &utils::asdict<value_type>)
+      .def("write_into", &utils::write_into<value_type>, pybind11::arg("array").noconvert(), pybind11::arg("row"))
       .def("__repr__", [](value_type const &value) {
         using namespace std::literals;
         return fmt::format("{}"sv, value);
       });
 }
 
+template <>
+struct utils::Fields<roq::Measurement> final {
+  template <typename Callback>
+  static void apply(roq::Measurement const &value, Callback &&callback) {
+    using namespace std::literals;
+    callback("name"sv, value.name);
+    callback("value"sv, value.value);
+  }
+};
+
 template <>
 void utils::create_struct<roq::Measurement>(pybind11::module_ &module) {
   using value_type = roq::Measurement;
@@ -91,12 +165,28 @@ void utils::create_struct<roq::Measurement>(pybind11::module_ &module) {
   pybind11::class_<value_type>(module, name.c_str())
       .def_property_readonly("name", [](value_type const &value) { return value.name; })
       .def_property_readonly("value", [](value_type const &value) { return value.value; })
+      .def("astuple", &utils::astuple<value_type>)
+      .def("asdict", &utils::asdict<value_type>)
+      .def("write_into", &utils::write_into<value_type>, pybind11::arg("array").noconvert(), pybind11::arg("row"))
       .def("__repr__", [](value_type const &value) {
         using namespace std::literals;
         return fmt::format("{}"sv, value);
       });
 }
 
+template <>
+struct utils::Fields<roq::RateLimit> final {
+  template <typename Callback>
+  static void apply(roq::RateLimit const &value, Callback &&callback) {
+    using namespace std::literals;
+    callback("type"sv, value.type);
+    callback("period"sv, value.period);
+    callback("end_time_utc"sv, value.end_time_utc);
+    callback("limit"sv, value.limit);
+    callback("value"sv, value.value);
+  }
+};
+
 template <>
 void utils::create_struct<roq::RateLimit>(pybind11::module_ &module) {
   using value_type = roq::RateLimit;
@@ -104,15 +194,33 @@ void utils::create_struct<roq::RateLimit>(pybind11::module_ &module) {
   pybind11::class_<value_type>(module, name.c_str())
       .def_property_readonly("type", [](value_type const &value) { return value.type; })
       .def_property_readonly("period", [](value_type const &value) { return value.period; })
+      .def_property_readonly("period_ns", [](value_type const &value) { return utils::to_nanoseconds(value.period); })
       .def_property_readonly("end_time_utc", [](value_type const &value) { return value.end_time_utc; })
+      .def_property_readonly(
+          "end_time_utc_ns", [](value_type const &value) { return utils::to_nanoseconds(value.end_time_utc); })
       .def_property_readonly("limit", [](value_type const &value) { return value.limit; })
       .def_property_readonly("value", [](value_type const &value) { return value.value; })
+      .def("astuple", &utils::astuple<value_type>)
+      .def("asdict", &utils::asdict<value_type>)
+      .def("write_into", &utils::write_into<value_type>, pybind11::arg("array").noconvert(), pybind11::arg("row"))
       .def("__repr__", [](value_type const &value) {
         using namespace std::literals;
         return fmt::format("{}"sv, value);
       });
 }
 
+template <>
+struct utils::Fields<roq::Statistics> final {
+  template <typename Callback>
+  static void apply(roq::Statistics const &value, Callback &&callback) {
+    using namespace std::literals;
+    callback("type"sv, value.type);
+    callback("value"sv, value.value);
+    callback("begin_time_utc"sv, value.begin_time_utc);
+    callback("end_time_utc"sv, value.end_time_utc);
+  }
+};
+
 template <>
 void utils::create_struct<roq::Statistics>(pybind11::module_ &module) {
   using value_type = roq::Statistics;
@@ -121,13 +229,32 @@ void utils::create_struct<roq::Statistics>(pybind11::module_ &module) {
       .def_property_readonly("type", [](value_type const &value) { return value.type; })
       .def_property_readonly("value", [](value_type const &value) { return value.value; })
       .def_property_readonly("begin_time_utc", [](value_type const &value) { return value.begin_time_utc; })
+      .def_property_readonly(
+          "begin_time_utc_ns", [](value_type const &value) { return utils::to_nanoseconds(value.begin_time_utc); })
       .def_property_readonly("end_time_utc", [](value_type const &value) { return value.end_time_utc; })
+      .def_property_readonly(
+          "end_time_utc_ns", [](value_type const &value) { return utils::to_nanoseconds(value.end_time_utc); })
+      .def("astuple", &utils::astuple<value_type>)
+      .def("asdict", &utils::asdict<value_type>)
+      .def("write_into", &utils::write_into<value_type>, pybind11::arg("array").noconvert(), pybind11::arg("row"))
       .def("__repr__", [](value_type const &value) {
         using namespace std::literals;
         return fmt::format("{}"sv, value);
       });
 }
 
+template <>
+struct utils::Fields<roq::Trade> final {
+  template <typename Callback>
+  static void apply(roq::Trade const &value, Callback &&callback) {
+    using namespace std::literals;
+    callback("side"sv, value.side);
+    callback("price"sv, value.price);
+    callback("quantity"sv, value.quantity);
+    callback("trade_id"sv, value.trade_id);
+  }
+};
+
 template <>
 void utils::create_struct<roq::Trade>(pybind11::module_ &module) {
   using value_type = roq::Trade;
@@ -137,6 +264,9 @@ void utils::create_struct<roq::Trade>(pybind11::module_ &module) {
       .def_property_readonly("price", [](value_type const &value) { return value.price; })
       .def_property_readonly("quantity", [](value_type const &value) { return value.quantity; })
       .def_property_readonly("trade_id", [](value_type const &value) { return value.trade_id; })
+      .def("astuple", &utils::astuple<value_type>)
+      .def("asdict", &utils::asdict<value_type>)
+      .def("write_into", &utils::write_into<value_type>, pybind11::arg("array").noconvert(), pybind11::arg("row"))
       .def("__repr__", [](value_type const &value) {
         using namespace std::literals;
         return fmt::format("{}"sv, value);
@@ -153,8 +283,51 @@ void utils::create_struct<roq::UUID>(pybind11::module_ &module) {
   });
 }
 
+// views
+
+template <>
+void utils::create_struct<utils::View<roq::Fill>>(pybind11::module_ &module) {
+  utils::create_view<roq::Fill>(module);
+}
+
+template <>
+void utils::create_struct<utils::View<roq::MBPUpdate>>(pybind11::module_ &module) {
+  PYBIND11_NUMPY_DTYPE(roq::MBPUpdate, price, quantity, implied_quantity, number_of_orders, update_action, price_level);
+  utils::create_view<roq::MBPUpdate, true>(module);
+}
+
+template <>
+void utils::create_struct<utils::View<roq::MBOUpdate>>(pybind11::module_ &module) {
+  utils::create_view<roq::MBOUpdate>(module);
+}
+
+template <>
+void utils::create_struct<utils::View<roq::Trade>>(pybind11::module_ &module) {
+  utils::create_view<roq::Trade>(module);
+}
+
 // transport
 
+template <>
+struct utils::Fields<roq::MessageInfo> final {
+  template <typename Callback>
+  static void apply(roq::MessageInfo const &value, Callback &&callback) {
+    using namespace std::literals;
+    callback("source"sv, value.source);
+    callback("source_name"sv, value.source_name);
+    callback("source_session_id"sv, value.source_session_id);
+    callback("source_seqno"sv, value.source_seqno);
+    callback("receive_time_utc"sv, value.receive_time_utc);
+    callback("receive_time"sv, value.receive_time);
+    callback("source_send_time"sv, value.source_send_time);
+    callback("source_receive_time"sv, value.source_receive_time);
+    callback("origin_create_time"sv, value.origin_create_time);
+    callback("origin_create_time_utc"sv, value.origin_create_time_utc);
+    callback("is_last"sv, value.is_last);
+    callback("opaque"sv, value.opaque);
+  }
+};
+
 template <>
 void utils::create_ref_struct<roq::MessageInfo>(pybind11::module_ &module) {
   using value_type = roq::MessageInfo;
@@ -191,36 +364,72 @@ void utils::create_ref_struct<roq::MessageInfo>(pybind11::module_ &module) {
             auto &value = static_cast<value_type const &>(obj);
             return value.receive_time_utc;
           })
+      .def_property_readonly(
+          "receive_time_utc_ns",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return utils::to_nanoseconds(value.receive_time_utc);
+          })
       .def_property_readonly(
           "receive_time",
           [](ref_type const &obj) {
             auto &value = static_cast<value_type const &>(obj);
             return value.receive_time;
           })
+      .def_property_readonly(
+          "receive_time_ns",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return utils::to_nanoseconds(value.receive_time);
+          })
       .def_property_readonly(
           "source_send_time",
           [](ref_type const &obj) {
             auto &value = static_cast<value_type const &>(obj);
             return value.source_send_time;
           })
+      .def_property_readonly(
+          "source_send_time_ns",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return utils::to_nanoseconds(value.source_send_time);
+          })
       .def_property_readonly(
           "source_receive_time",
           [](ref_type const &obj) {
             auto &value = static_cast<value_type const &>(obj);
             return value.source_receive_time;
           })
+      .def_property_readonly(
+          "source_receive_time_ns",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return utils::to_nanoseconds(value.source_receive_time);
+          })
       .def_property_readonly(
           "origin_create_time",
           [](ref_type const &obj) {
             auto &value = static_cast<value_type const &>(obj);
             return value.origin_create_time;
           })
+      .def_property_readonly(
+          "origin_create_time_ns",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return utils::to_nanoseconds(value.origin_create_time);
+          })
       .def_property_readonly(
           "origin_create_time_utc",
           [](ref_type const &obj) {
             auto &value = static_cast<value_type const &>(obj);
             return value.origin_create_time_utc;
           })
+      .def_property_readonly(
+          "origin_create_time_utc_ns",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return utils::to_nanoseconds(value.origin_create_time_utc);
+          })
       .def_property_readonly(
           "is_last",
           [](ref_type const &obj) {
@@ -233,6 +442,9 @@ void utils::create_ref_struct<roq::MessageInfo>(pybind11::module_ &module) {
             auto &value = static_cast<value_type const &>(obj);
             return value.opaque;
           })
+      .def("astuple", &utils::astuple<ref_type>)
+      .def("asdict", &utils::asdict<ref_type>)
+      .def("write_into", &utils::write_into<ref_type>, pybind11::arg("array").noconvert(), pybind11::arg("row"))
       .def("__repr__", [](ref_type const &obj) {
         using namespace std::literals;
         auto &value = static_cast<value_type const &>(obj);
@@ -266,6 +478,15 @@ void utils::create_ref_struct<roq::Stop>(pybind11::module_ &module) {
   });
 }
 
+template <>
+struct utils::Fields<roq::Timer> final {
+  template <typename Callback>
+  static void apply(roq::Timer const &value, Callback &&callback) {
+    using namespace std::literals;
+    callback("now"sv, value.now);
+  }
+};
+
 template <>
 void utils::create_ref_struct<roq::Timer>(pybind11::module_ &module) {
   using value_type = roq::Timer;
@@ -278,6 +499,15 @@ void utils::create_ref_struct<roq::Timer>(pybind11::module_ &module) {
             auto &value = static_cast<value_type const &>(obj);
             return value.now;
           })
+      .def_property_readonly(
+          "now_ns",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return utils::to_nanoseconds(value.now);
+          })
+      .def("astuple", &utils::astuple<ref_type>)
+      .def("asdict", &utils::asdict<ref_type>)
+      .def("write_into", &utils::write_into<ref_type>, pybind11::arg("array").noconvert(), pybind11::arg("row"))
       .def("__repr__", [](ref_type const &obj) {
         using namespace std::literals;
         auto &value = static_cast<value_type const &>(obj);
@@ -309,6 +539,15 @@ void utils::create_ref_struct<roq::Disconnected>(pybind11::module_ &module) {
   });
 }
 
+template <>
+struct utils::Fields<roq::DownloadBegin> final {
+  template <typename Callback>
+  static void apply(roq::DownloadBegin const &value, Callback &&callback) {
+    using namespace std::literals;
+    callback("account"sv, value.account);
+  }
+};
+
 template <>
 void utils::create_ref_struct<roq::DownloadBegin>(pybind11::module_ &module) {
   using value_type = roq::DownloadBegin;
@@ -321,6 +560,9 @@ void utils::create_ref_struct<roq::DownloadBegin>(pybind11::module_ &module) {
             auto &value = static_cast<value_type const &>(obj);
             return value.account;
           })
+      .def("astuple", &utils::astuple<ref_type>)
+      .def("asdict", &utils::asdict<ref_type>)
+      .def("write_into", &utils::write_into<ref_type>, pybind11::arg("array").noconvert(), pybind11::arg("row"))
       .def("__repr__", [](ref_type const &obj) {
         using namespace std::literals;
         auto &value = static_cast<value_type const &>(obj);
@@ -328,6 +570,16 @@ void utils::create_ref_struct<roq::DownloadBegin>(pybind11::module_ &module) {
       });
 }
 
+template <>
+struct utils::Fields<roq::DownloadEnd> final {
+  template <typename Callback>
+  static void apply(roq::DownloadEnd const &value, Callback &&callback) {
+    using namespace std::literals;
+    callback("account"sv, value.account);
+    callback("max_order_id"sv, value.max_order_id);
+  }
+};
+
 template <>
 void utils::create_ref_struct<roq::DownloadEnd>(pybind11::module_ &module) {
   using value_type = roq::DownloadEnd;
@@ -346,6 +598,9 @@ void utils::create_ref_struct<roq::DownloadEnd>(pybind11::module_ &module) {
             auto &value = static_cast<value_type const &>(obj);
             return value.max_order_id;
           })
+      .def("astuple", &utils::astuple<ref_type>)
+      .def("asdict", &utils::asdict<ref_type>)
+      .def("write_into", &utils::write_into<ref_type>, pybind11::arg("array").noconvert(), pybind11::arg("row"))
       .def("__repr__", [](ref_type const &obj) {
         using namespace std::literals;
         auto &value = static_cast<value_type const &>(obj);
@@ -353,6 +608,17 @@ void utils::create_ref_struct<roq::DownloadEnd>(pybind11::module_ &module) {
       });
 }
 
+template <>
+struct utils::Fields<roq::ExternalLatency> final {
+  template <typename Callback>
+  static void apply(roq::ExternalLatency const &value, Callback &&callback) {
+    using namespace std::literals;
+    callback("stream_id"sv, value.stream_id);
+    callback("account"sv, value.account);
+    callback("latency"sv, value.latency);
+  }
+};
+
 template <>
 void utils::create_ref_struct<roq::ExternalLatency>(pybind11::module_ &module) {
   using value_type = roq::ExternalLatency;
@@ -377,6 +643,15 @@ void utils::create_ref_struct<roq::ExternalLatency>(pybind11::module_ &module) {
             auto &value = static_cast<value_type const &>(obj);
             return value.latency;
           })
+      .def_property_readonly(
+          "latency_ns",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return utils::to_nanoseconds(value.latency);
+          })
+      .def("astuple", &utils::astuple<ref_type>)
+      .def("asdict", &utils::asdict<ref_type>)
+      .def("write_into", &utils::write_into<ref_type>, pybind11::arg("array").noconvert(), pybind11::arg("row"))
       .def("__repr__", [](ref_type const &obj) {
         using namespace std::literals;
         auto &value = static_cast<value_type const &>(obj);
@@ -384,6 +659,23 @@ void utils::create_ref_struct<roq::ExternalLatency>(pybind11::module_ &module) {
       });
 }
 
+template <>
+struct utils::Fields<roq::GatewaySettings> final {
+  template <typename Callback>
+  static void apply(roq::GatewaySettings const &value, Callback &&callback) {
+    using namespace std::literals;
+    callback("supports"sv, value.supports);
+    callback("mbp_max_depth"sv, value.mbp_max_depth);
+    callback("mbp_tick_size_multiplier"sv, value.mbp_tick_size_multiplier);
+    callback("mbp_min_trade_vol_multiplier"sv, value.mbp_min_trade_vol_multiplier);
+    callback("mbp_allow_remove_non_existing"sv, value.mbp_allow_remove_non_existing);
+    callback("mbp_allow_price_inversion"sv, value.mbp_allow_price_inversion);
+    callback("oms_download_has_state"sv, value.oms_download_has_state);
+    callback("oms_download_has_routing_id"sv, value.oms_download_has_routing_id);
+    callback("oms_request_id_type"sv, value.oms_request_id_type);
+  }
+};
+
 template <>
 void utils::create_ref_struct<roq::GatewaySettings>(pybind11::module_ &module) {
   using value_type = roq::GatewaySettings;
@@ -444,6 +736,9 @@ void utils::create_ref_struct<roq::GatewaySettings>(pybind11::module_ &module) {
             auto &value = static_cast<value_type const &>(obj);
             return value.oms_request_id_type;
           })
+      .def("astuple", &utils::astuple<ref_type>)
+      .def("asdict", &utils::asdict<ref_type>)
+      .def("write_into", &utils::write_into<ref_type>, pybind11::arg("array").noconvert(), pybind11::arg("row"))
       .def("__repr__", [](ref_type const &obj) {
         using namespace std::literals;
         auto &value = static_cast<value_type const &>(obj);
@@ -451,6 +746,18 @@ void utils::create_ref_struct<roq::GatewaySettings>(pybind11::module_ &module) {
       });
 }
 
+template <>
+struct utils::Fields<roq::GatewayStatus> final {
+  template <typename Callback>
+  static void apply(roq::GatewayStatus const &value, Callback &&callback) {
+    using namespace std::literals;
+    callback("account"sv, value.account);
+    callback("supported"sv, value.supported);
+    callback("available"sv, value.available);
+    callback("unavailable"sv, value.unavailable);
+  }
+};
+
 template <>
 void utils::create_ref_struct<roq::GatewayStatus>(pybind11::module_ &module) {
   using value_type = roq::GatewayStatus;
@@ -481,6 +788,9 @@ void utils::create_ref_struct<roq::GatewayStatus>(pybind11::module_ &module) {
             auto &value = static_cast<value_type const &>(obj);
             return utils::to_int_flag(value.unavailable);
           })
+      .def("astuple", &utils::astuple<ref_type>)
+      .def("asdict", &utils::asdict<ref_type>)
+      .def("write_into", &utils::write_into<ref_type>, pybind11::arg("array").noconvert(), pybind11::arg("row"))
       .def("__repr__", [](ref_type const &obj) {
         using namespace std::literals;
         auto &value = static_cast<value_type const &>(obj);
@@ -488,6 +798,26 @@ void utils::create_ref_struct<roq::GatewayStatus>(pybind11::module_ &module) {
       });
 }
 
+template <>
+struct utils::Fields<roq::MarketByPriceUpdate> final {
+  template <typename Callback>
+  static void apply(roq::MarketByPriceUpdate const &value, Callback &&callback) {
+    using namespace std::literals;
+    callback("exchange"sv, value.exchange);
+    callback("symbol"sv, value.symbol);
+    callback("bids"sv, value.bids);
+    callback("asks"sv, value.asks);
+    callback("update_type"sv, value.update_type);
+    callback("exchange_time_utc"sv, value.exchange_time_utc);
+    callback("exchange_sequence"sv, value.exchange_sequence);
+    callback("sending_time_utc"sv, value.sending_time_utc);
+    callback("price_precision"sv, value.price_precision);
+    callback("quantity_precision"sv, value.quantity_precision);
+    callback("max_depth"sv, value.max_depth);
+    callback("checksum"sv, value.checksum);
+  }
+};
+
 template <>
 void utils::create_ref_struct<roq::MarketByPriceUpdate>(pybind11::module_ &module) {
   using value_type = roq::MarketByPriceUpdate;
@@ -508,16 +838,16 @@ void utils::create_ref_struct<roq::MarketByPriceUpdate>(pybind11::module_ &modul
           })
       .def_property_readonly(
           "bids",
-          [](ref_type const &obj) {
+          utils::create_view_getter([](ref_type const &obj) {
             auto &value = static_cast<value_type const &>(obj);
-            return utils::to_list(value.bids);
-          })
+            return utils::View<roq::MBPUpdate>{value.bids};
+          }))
       .def_property_readonly(
           "asks",
-          [](ref_type const &obj) {
+          utils::create_view_getter([](ref_type const &obj) {
             auto &value = static_cast<value_type const &>(obj);
-            return utils::to_list(value.asks);
-          })
+            return utils::View<roq::MBPUpdate>{value.asks};
+          }))
       .def_property_readonly(
           "update_type",
           [](ref_type const &obj) {
@@ -530,6 +860,12 @@ void utils::create_ref_struct<roq::MarketByPriceUpdate>(pybind11::module_ &modul
             auto &value = static_cast<value_type const &>(obj);
             return value.exchange_time_utc;
           })
+      .def_property_readonly(
+          "exchange_time_utc_ns",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return utils::to_nanoseconds(value.exchange_time_utc);
+          })
       .def_property_readonly(
           "exchange_sequence",
           [](ref_type const &obj) {
@@ -542,6 +878,12 @@ void utils::create_ref_struct<roq::MarketByPriceUpdate>(pybind11::module_ &modul
             auto &value = static_cast<value_type const &>(obj);
             return value.sending_time_utc;
           })
+      .def_property_readonly(
+          "sending_time_utc_ns",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return utils::to_nanoseconds(value.sending_time_utc);
+          })
       .def_property_readonly(
           "price_precision",
           [](ref_type const &obj) {
@@ -566,6 +908,9 @@ void utils::create_ref_struct<roq::MarketByPriceUpdate>(pybind11::module_ &modul
             auto &value = static_cast<value_type const &>(obj);
             return value.checksum;
           })
+      .def("astuple", &utils::astuple<ref_type>)
+      .def("asdict", &utils::asdict<ref_type>)
+      .def("write_into", &utils::write_into<ref_type>, pybind11::arg("array").noconvert(), pybind11::arg("row"))
       .def("__repr__", [](ref_type const &obj) {
         using namespace std::literals;
         auto &value = static_cast<value_type const &>(obj);
@@ -573,6 +918,25 @@ void utils::create_ref_struct<roq::MarketByPriceUpdate>(pybind11::module_ &modul
       });
 }
 
+template <>
+struct utils::Fields<roq::MarketByOrderUpdate> final {
+  template <typename Callback>
+  static void apply(roq::MarketByOrderUpdate const &value, Callback &&callback) {
+    using namespace std::literals;
+    callback("exchange"sv, value.exchange);
+    callback("symbol"sv, value.symbol);
+    callback("orders"sv, value.orders);
+    callback("update_type"sv, value.update_type);
+    callback("exchange_time_utc"sv, value.exchange_time_utc);
+    callback("exchange_sequence"sv, value.exchange_sequence);
+    callback("sending_time_utc"sv, value.sending_time_utc);
+    callback("price_precision"sv, value.price_precision);
+    callback("quantity_precision"sv, value.quantity_precision);
+    callback("max_depth"sv, value.max_depth);
+    callback("checksum"sv, value.checksum);
+  }
+};
+
 template <>
 void utils::create_ref_struct<roq::MarketByOrderUpdate>(pybind11::module_ &module) {
   using value_type = roq::MarketByOrderUpdate;
@@ -593,10 +957,10 @@ void utils::create_ref_struct<roq::MarketByOrderUpdate>(pybind11::module_ &modul
           })
       .def_property_readonly(
           "orders",
-          [](ref_type const &obj) {
+          utils::create_view_getter([](ref_type const &obj) {
             auto &value = static_cast<value_type const &>(obj);
-            return utils::to_list(value.orders);
-          })
+            return utils::View<roq::MBOUpdate>{value.orders};
+          }))
       .def_property_readonly(
           "update_type",
           [](ref_type const &obj) {
@@ -609,6 +973,12 @@ void utils::create_ref_struct<roq::MarketByOrderUpdate>(pybind11::module_ &modul
             auto &value = static_cast<value_type const &>(obj);
             return value.exchange_time_utc;
           })
+      .def_property_readonly(
+          "exchange_time_utc_ns",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return utils::to_nanoseconds(value.exchange_time_utc);
+          })
       .def_property_readonly(
           "exchange_sequence",
           [](ref_type const &obj) {
@@ -621,6 +991,12 @@ void utils::create_ref_struct<roq::MarketByOrderUpdate>(pybind11::module_ &modul
             auto &value = static_cast<value_type const &>(obj);
             return value.sending_time_utc;
           })
+      .def_property_readonly(
+          "sending_time_utc_ns",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return utils::to_nanoseconds(value.sending_time_utc);
+          })
       .def_property_readonly(
           "price_precision",
           [](ref_type const &obj) {
@@ -645,6 +1021,9 @@ void utils::create_ref_struct<roq::MarketByOrderUpdate>(pybind11::module_ &modul
             auto &value = static_cast<value_type const &>(obj);
             return value.checksum;
           })
+      .def("astuple", &utils::astuple<ref_type>)
+      .def("asdict", &utils::asdict<ref_type>)
+      .def("write_into", &utils::write_into<ref_type>, pybind11::arg("array").noconvert(), pybind11::arg("row"))
       .def("__repr__", [](ref_type const &obj) {
         using namespace std::literals;
         auto &value = static_cast<value_type const &>(obj);
@@ -652,6 +1031,18 @@ void utils::create_ref_struct<roq::MarketByOrderUpdate>(pybind11::module_ &modul
       });
 }
 
+template <>
+struct utils::Fields<roq::MarketStatus> final {
+  template <typename Callback>
+  static void apply(roq::MarketStatus const &value, Callback &&callback) {
+    using namespace std::literals;
+    callback("stream_id"sv, value.stream_id);
+    callback("exchange"sv, value.exchange);
+    callback("symbol"sv, value.symbol);
+    callback("trading_status"sv, value.trading_status);
+  }
+};
+
 template <>
 void utils::create_ref_struct<roq::MarketStatus>(pybind11::module_ &module) {
   using value_type = roq::MarketStatus;
@@ -682,6 +1073,9 @@ void utils::create_ref_struct<roq::MarketStatus>(pybind11::module_ &module) {
             auto &value = static_cast<value_type const &>(obj);
             return value.trading_status;
           })
+      .def("astuple", &utils::astuple<ref_type>)
+      .def("asdict", &utils::asdict<ref_type>)
+      .def("write_into", &utils::write_into<ref_type>, pybind11::arg("array").noconvert(), pybind11::arg("row"))
       .def("__repr__", [](ref_type const &obj) {
         using namespace std::literals;
         auto &value = static_cast<value_type const &>(obj);
@@ -689,6 +1083,18 @@ void utils::create_ref_struct<roq::MarketStatus>(pybind11::module_ &module) {
       });
 }
 
+template <>
+struct utils::Fields<roq::RateLimitsUpdate> final {
+  template <typename Callback>
+  static void apply(roq::RateLimitsUpdate const &value, Callback &&callback) {
+    using namespace std::literals;
+    callback("stream_id"sv, value.stream_id);
+    callback("account"sv, value.account);
+    callback("origin"sv, value.origin);
+    callback("rate_limits"sv, value.rate_limits);
+  }
+};
+
 template <>
 void utils::create_ref_struct<roq::RateLimitsUpdate>(pybind11::module_ &module) {
   using value_type = roq::RateLimitsUpdate;
@@ -716,9 +1122,27 @@ void utils::create_ref_struct<roq::RateLimitsUpdate>(pybind11::module_ &module)
       .def_property_readonly("rate_limits", [](ref_type const &obj) {
         auto &value = static_cast<value_type const &>(obj);
         return utils::to_list(value.rate_limits);
-      });
+      })
+      .def("astuple", &utils::astuple<ref_type>)
+      .def("asdict", &utils::asdict<ref_type>)
+      .def("write_into", &utils::write_into<ref_type>, pybind11::arg("array").noconvert(), pybind11::arg("row"));
 }
 
+template <>
+struct utils::Fields<roq::RateLimitTrigger> final {
+  template <typename Callback>
+  static void apply(roq::RateLimitTrigger const &value, Callback &&callback) {
+    using namespace std::literals;
+    callback("name"sv, value.name);
+    callback("origin"sv, value.origin);
+    callback("type"sv, value.type);
+    callback("users"sv, value.users);
+    callback("accounts"sv, value.accounts);
+    callback("ban_expires"sv, value.ban_expires);
+    callback("triggered_by"sv, value.triggered_by);
+  }
+};
+
 template <>
 void utils::create_ref_struct<roq::RateLimitTrigger>(pybind11::module_ &module) {
   using value_type = roq::RateLimitTrigger;
@@ -761,12 +1185,21 @@ void utils::create_ref_struct<roq::RateLimitTrigger>(pybind11::module_ &module)
             auto &value = static_cast<value_type const &>(obj);
             return value.ban_expires;
           })
+      .def_property_readonly(
+          "ban_expires_ns",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return utils::to_nanoseconds(value.ban_expires);
+          })
       .def_property_readonly(
           "triggered_by",
           [](ref_type const &obj) {
             auto &value = static_cast<value_type const &>(obj);
             return value.triggered_by;
           })
+      .def("astuple", &utils::astuple<ref_type>)
+      .def("asdict", &utils::asdict<ref_type>)
+      .def("write_into", &utils::write_into<ref_type>, pybind11::arg("array").noconvert(), pybind11::arg("row"))
       .def("__repr__", [](ref_type const &obj) {
         using namespace std::literals;
         auto &value = static_cast<value_type const &>(obj);
@@ -774,6 +1207,37 @@ void utils::create_ref_struct<roq::RateLimitTrigger>(pybind11::module_ &module)
       });
 }
 
+template <>
+struct utils::Fields<roq::ReferenceData> final {
+  template <typename Callback>
+  static void apply(roq::ReferenceData const &value, Callback &&callback) {
+    using namespace std::literals;
+    callback("exchange"sv, value.exchange);
+    callback("symbol"sv, value.symbol);
+    callback("description"sv, value.description);
+    callback("security_type"sv, value.security_type);
+    callback("base_currency"sv, value.base_currency);
+    callback("quote_currency"sv, value.quote_currency);
+    callback("margin_currency"sv, value.margin_currency);
+    callback("commission_currency"sv, value.commission_currency);
+    callback("tick_size"sv, value.tick_size);
+    callback("multiplier"sv, value.multiplier);
+    callback("min_trade_vol"sv, value.min_trade_vol);
+    callback("max_trade_vol"sv, value.max_trade_vol);
+    callback("trade_vol_step_size"sv, value.trade_vol_step_size);
+    callback("option_type"sv, value.option_type);
+    callback("strike_currency"sv, value.strike_currency);
+    callback("strike_price"sv, value.strike_price);
+    callback("underlying"sv, value.underlying);
+    callback("time_zone"sv, value.time_zone);
+    callback("issue_date"sv, value.issue_date);
+    callback("settlement_date"sv, value.settlement_date);
+    callback("expiry_datetime"sv, value.expiry_datetime);
+    callback("expiry_datetime_utc"sv, value.expiry_datetime_utc);
+    callback("discard"sv, value.discard);
+  }
+};
+
 template <>
 void utils::create_ref_struct<roq::ReferenceData>(pybind11::module_ &module) {
   using value_type = roq::ReferenceData;
@@ -894,30 +1358,57 @@ void utils::create_ref_struct<roq::ReferenceData>(pybind11::module_ &module) {
             auto &value = static_cast<value_type const &>(obj);
             return value.issue_date;
           })
+      .def_property_readonly(
+          "issue_date_ns",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return utils::to_nanoseconds(value.issue_date);
+          })
       .def_property_readonly(
           "settlement_date",
           [](ref_type const &obj) {
             auto &value = static_cast<value_type const &>(obj);
             return value.settlement_date;
           })
+      .def_property_readonly(
+          "settlement_date_ns",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return utils::to_nanoseconds(value.settlement_date);
+          })
       .def_property_readonly(
           "expiry_datetime",
           [](ref_type const &obj) {
             auto &value = static_cast<value_type const &>(obj);
             return value.expiry_datetime;
           })
+      .def_property_readonly(
+          "expiry_datetime_ns",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return utils::to_nanoseconds(value.expiry_datetime);
+          })
       .def_property_readonly(
           "expiry_datetime_utc",
           [](ref_type const &obj) {
             auto &value = static_cast<value_type const &>(obj);
             return value.expiry_datetime_utc;
           })
+      .def_property_readonly(
+          "expiry_datetime_utc_ns",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return utils::to_nanoseconds(value.expiry_datetime_utc);
+          })
       .def_property_readonly(
           "discard",
           [](ref_type const &obj) {
             auto &value = static_cast<value_type const &>(obj);
             return value.discard;
           })
+      .def("astuple", &utils::astuple<ref_type>)
+      .def("asdict", &utils::asdict<ref_type>)
+      .def("write_into", &utils::write_into<ref_type>, pybind11::arg("array").noconvert(), pybind11::arg("row"))
       .def("__repr__", [](ref_type const &obj) {
         using namespace std::literals;
         auto &value = static_cast<value_type const &>(obj);
@@ -925,6 +1416,22 @@ void utils::create_ref_struct<roq::ReferenceData>(pybind11::module_ &module) {
       });
 }
 
+template <>
+struct utils::Fields<roq::StatisticsUpdate> final {
+  template <typename Callback>
+  static void apply(roq::StatisticsUpdate const &value, Callback &&callback) {
+    using namespace std::literals;
+    callback("stream_id"sv, value.stream_id);
+    callback("exchange"sv, value.exchange);
+    callback("symbol"sv, value.symbol);
+    callback("statistics"sv, value.statistics);
+    callback("update_type"sv, value.update_type);
+    callback("exchange_time_utc"sv, value.exchange_time_utc);
+    callback("exchange_sequence"sv, value.exchange_sequence);
+    callback("sending_time_utc"sv, value.sending_time_utc);
+  }
+};
+
 template <>
 void utils::create_ref_struct<roq::StatisticsUpdate>(pybind11::module_ &module) {
   using value_type = roq::StatisticsUpdate;
@@ -967,6 +1474,12 @@ void utils::create_ref_struct<roq::StatisticsUpdate>(pybind11::module_ &module)
             auto &value = static_cast<value_type const &>(obj);
             return value.exchange_time_utc;
           })
+      .def_property_readonly(
+          "exchange_time_utc_ns",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return utils::to_nanoseconds(value.exchange_time_utc);
+          })
       .def_property_readonly(
           "exchange_sequence",
           [](ref_type const &obj) {
@@ -979,6 +1492,15 @@ void utils::create_ref_struct<roq::StatisticsUpdate>(pybind11::module_ &module)
             auto &value = static_cast<value_type const &>(obj);
             return value.sending_time_utc;
           })
+      .def_property_readonly(
+          "sending_time_utc_ns",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return utils::to_nanoseconds(value.sending_time_utc);
+          })
+      .def("astuple", &utils::astuple<ref_type>)
+      .def("asdict", &utils::asdict<ref_type>)
+      .def("write_into", &utils::write_into<ref_type>, pybind11::arg("array").noconvert(), pybind11::arg("row"))
       .def("__repr__", [](ref_type const &obj) {
         using namespace std::literals;
         auto &value = static_cast<value_type const &>(obj);
@@ -986,6 +1508,26 @@ void utils::create_ref_struct<roq::StatisticsUpdate>(pybind11::module_ &module)
       });
 }
 
+template <>
+struct utils::Fields<roq::StreamStatus> final {
+  template <typename Callback>
+  static void apply(roq::StreamStatus const &value, Callback &&callback) {
+    using namespace std::literals;
+    callback("stream_id"sv, value.stream_id);
+    callback("account"sv, value.account);
+    callback("supports"sv, value.supports);
+    callback("transport"sv, value.transport);
+    callback("protocol"sv, value.protocol);
+    callback("encoding"sv, value.encoding);
+    callback("priority"sv, value.priority);
+    callback("connection_status"sv, value.connection_status);
+    callback("interface"sv, value.interface);
+    callback("authority"sv, value.authority);
+    callback("path"sv, value.path);
+    callback("proxy"sv, value.proxy);
+  }
+};
+
 template <>
 void utils::create_ref_struct<roq::StreamStatus>(pybind11::module_ &module) {
   using value_type = roq::StreamStatus;
@@ -1064,6 +1606,9 @@ void utils::create_ref_struct<roq::StreamStatus>(pybind11::module_ &module) {
             auto &value = static_cast<value_type const &>(obj);
             return value.proxy;
           })
+      .def("astuple", &utils::astuple<ref_type>)
+      .def("asdict", &utils::asdict<ref_type>)
+      .def("write_into", &utils::write_into<ref_type>, pybind11::arg("array").noconvert(), pybind11::arg("row"))
       .def("__repr__", [](ref_type const &obj) {
         using namespace std::literals;
         auto &value = static_cast<value_type const &>(obj);
@@ -1071,6 +1616,21 @@ void utils::create_ref_struct<roq::StreamStatus>(pybind11::module_ &module) {
       });
 }
 
+template <>
+struct utils::Fields<roq::TopOfBook> final {
+  template <typename Callback>
+  static void apply(roq::TopOfBook const &value, Callback &&callback) {
+    using namespace std::literals;
+    callback("exchange"sv, value.exchange);
+    callback("symbol"sv, value.symbol);
+    callback("layer"sv, value.layer);
+    callback("update_type"sv, value.update_type);
+    callback("exchange_time_utc"sv, value.exchange_time_utc);
+    callback("exchange_sequence"sv, value.exchange_sequence);
+    callback("sending_time_utc"sv, value.sending_time_utc);
+  }
+};
+
 template <>
 void utils::create_ref_struct<roq::TopOfBook>(pybind11::module_ &module) {
   using value_type = roq::TopOfBook;
@@ -1107,6 +1667,12 @@ void utils::create_ref_struct<roq::TopOfBook>(pybind11::module_ &module) {
             auto &value = static_cast<value_type const &>(obj);
             return value.exchange_time_utc;
           })
+      .def_property_readonly(
+          "exchange_time_utc_ns",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return utils::to_nanoseconds(value.exchange_time_utc);
+          })
       .def_property_readonly(
           "exchange_sequence",
           [](ref_type const &obj) {
@@ -1119,6 +1685,15 @@ void utils::create_ref_struct<roq::TopOfBook>(pybind11::module_ &module) {
             auto &value = static_cast<value_type const &>(obj);
             return value.sending_time_utc;
           })
+      .def_property_readonly(
+          "sending_time_utc_ns",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return utils::to_nanoseconds(value.sending_time_utc);
+          })
+      .def("astuple", &utils::astuple<ref_type>)
+      .def("asdict", &utils::asdict<ref_type>)
+      .def("write_into", &utils::write_into<ref_type>, pybind11::arg("array").noconvert(), pybind11::arg("row"))
       .def("__repr__", [](ref_type const &obj) {
         using namespace std::literals;
         auto &value = static_cast<value_type const &>(obj);
@@ -1126,6 +1701,19 @@ void utils::create_ref_struct<roq::TopOfBook>(pybind11::module_ &module) {
       });
 }
 
+template <>
+struct utils::Fields<roq::TradeSummary> final {
+  template <typename Callback>
+  static void apply(roq::TradeSummary const &value, Callback &&callback) {
+    using namespace std::literals;
+    callback("stream_id"sv, value.stream_id);
+    callback("exchange"sv, value.exchange);
+    callback("symbol"sv, value.symbol);
+    callback("trades"sv, value.trades);
+    callback("exchange_time_utc"sv, value.exchange_time_utc);
+  }
+};
+
 template <>
 void utils::create_ref_struct<roq::TradeSummary>(pybind11::module_ &module) {
   using value_type = roq::TradeSummary;
@@ -1152,16 +1740,25 @@ void utils::create_ref_struct<roq::TradeSummary>(pybind11::module_ &module) {
           })
       .def_property_readonly(
           "trades",
-          [](ref_type const &obj) {
+          utils::create_view_getter([](ref_type const &obj) {
             auto &value = static_cast<value_type const &>(obj);
-            return utils::to_list(value.trades);
-          })
+            return utils::View<roq::Trade>{value.trades};
+          }))
       .def_property_readonly(
           "exchange_time_utc",
           [](ref_type const &obj) {
             auto &value = static_cast<value_type const &>(obj);
             return value.exchange_time_utc;
           })
+      .def_property_readonly(
+          "exchange_time_utc_ns",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return utils::to_nanoseconds(value.exchange_time_utc);
+          })
+      .def("astuple", &utils::astuple<ref_type>)
+      .def("asdict", &utils::asdict<ref_type>)
+      .def("write_into", &utils::write_into<ref_type>, pybind11::arg("array").noconvert(), pybind11::arg("row"))
       .def("__repr__", [](ref_type const &obj) {
         using namespace std::literals;
         auto &value = static_cast<value_type const &>(obj);
@@ -1171,6 +1768,31 @@ void utils::create_ref_struct<roq::TradeSummary>(pybind11::module_ &module) {
 
 // ...
 
+template <>
+struct utils::Fields<roq::CreateOrder> final {
+  template <typename Callback>
+  static void apply(roq::CreateOrder const &value, Callback &&callback) {
+    using namespace std::literals;
+    callback("account"sv, value.account);
+    callback("order_id"sv, value.order_id);
+    callback("exchange"sv, value.exchange);
+    callback("symbol"sv, value.symbol);
+    callback("side"sv, value.side);
+    callback("position_effect"sv, value.position_effect);
+    callback("margin_mode"sv, value.margin_mode);
+    callback("max_show_quantity"sv, value.max_show_quantity);
+    callback("order_type"sv, value.order_type);
+    callback("time_in_force"sv, value.time_in_force);
+    callback("execution_instructions"sv, value.execution_instructions);
+    callback("request_template"sv, value.request_template);
+    callback("quantity"sv, value.quantity);
+    callback("price"sv, value.price);
+    callback("stop_price"sv, value.stop_price);
+    callback("routing_id"sv, value.routing_id);
+    callback("strategy_id"sv, value.strategy_id);
+  }
+};
+
 template <>
 void utils::create_ref_struct<roq::CreateOrder>(pybind11::module_ &module) {
   using value_type = roq::CreateOrder;
@@ -1279,6 +1901,9 @@ void utils::create_ref_struct<roq::CreateOrder>(pybind11::module_ &module) {
             auto &value = static_cast<value_type const &>(obj);
             return value.strategy_id;
           })
+      .def("astuple", &utils::astuple<ref_type>)
+      .def("asdict", &utils::asdict<ref_type>)
+      .def("write_into", &utils::write_into<ref_type>, pybind11::arg("array").noconvert(), pybind11::arg("row"))
       .def("__repr__", [](ref_type const &obj) {
         using namespace std::literals;
         auto &value = static_cast<value_type const &>(obj);
@@ -1286,6 +1911,22 @@ void utils::create_ref_struct<roq::CreateOrder>(pybind11::module_ &module) {
       });
 }
 
+template <>
+struct utils::Fields<roq::ModifyOrder> final {
+  template <typename Callback>
+  static void apply(roq::ModifyOrder const &value, Callback &&callback) {
+    using namespace std::literals;
+    callback("account"sv, value.account);
+    callback("order_id"sv, value.order_id);
+    callback("request_template"sv, value.request_template);
+    callback("quantity"sv, value.quantity);
+    callback("price"sv, value.price);
+    callback("routing_id"sv, value.routing_id);
+    callback("version"sv, value.version);
+    callback("conditional_on_version"sv, value.conditional_on_version);
+  }
+};
+
 template <>
 void utils::create_ref_struct<roq::ModifyOrder>(pybind11::module_ &module) {
   using value_type = roq::ModifyOrder;
@@ -1340,6 +1981,9 @@ void utils::create_ref_struct<roq::ModifyOrder>(pybind11::module_ &module) {
             auto &value = static_cast<value_type const &>(obj);
             return value.conditional_on_version;
           })
+      .def("astuple", &utils::astuple<ref_type>)
+      .def("asdict", &utils::asdict<ref_type>)
+      .def("write_into", &utils::write_into<ref_type>, pybind11::arg("array").noconvert(), pybind11::arg("row"))
       .def("__repr__", [](ref_type const &obj) {
         using namespace std::literals;
         auto &value = static_cast<value_type const &>(obj);
@@ -1347,6 +1991,20 @@ void utils::create_ref_struct<roq::ModifyOrder>(pybind11::module_ &module) {
       });
 }
 
+template <>
+struct utils::Fields<roq::CancelOrder> final {
+  template <typename Callback>
+  static void apply(roq::CancelOrder const &value, Callback &&callback) {
+    using namespace std::literals;
+    callback("account"sv, value.account);
+    callback("order_id"sv, value.order_id);
+    callback("request_template"sv, value.request_template);
+    callback("routing_id"sv, value.routing_id);
+    callback("version"sv, value.version);
+    callback("conditional_on_version"sv, value.conditional_on_version);
+  }
+};
+
 template <>
 void utils::create_ref_struct<roq::CancelOrder>(pybind11::module_ &module) {
   using value_type = roq::CancelOrder;
@@ -1389,6 +2047,9 @@ void utils::create_ref_struct<roq::CancelOrder>(pybind11::module_ &module) {
             auto &value = static_cast<value_type const &>(obj);
             return value.conditional_on_version;
           })
+      .def("astuple", &utils::astuple<ref_type>)
+      .def("asdict", &utils::asdict<ref_type>)
+      .def("write_into", &utils::write_into<ref_type>, pybind11::arg("array").noconvert(), pybind11::arg("row"))
       .def("__repr__", [](ref_type const &obj) {
         using namespace std::literals;
         auto &value = static_cast<value_type const &>(obj);
@@ -1396,6 +2057,20 @@ void utils::create_ref_struct<roq::CancelOrder>(pybind11::module_ &module) {
       });
 }
 
+template <>
+struct utils::Fields<roq::CancelAllOrders> final {
+  template <typename Callback>
+  static void apply(roq::CancelAllOrders const &value, Callback &&callback) {
+    using namespace std::literals;
+    callback("account"sv, value.account);
+    callback("order_id"sv, value.order_id);
+    callback("exchange"sv, value.exchange);
+    callback("symbol"sv, value.symbol);
+    callback("strategy_id"sv, value.strategy_id);
+    callback("side"sv, value.side);
+  }
+};
+
 template <>
 void utils::create_ref_struct<roq::CancelAllOrders>(pybind11::module_ &module) {
   using value_type = roq::CancelAllOrders;
@@ -1438,6 +2113,9 @@ void utils::create_ref_struct<roq::CancelAllOrders>(pybind11::module_ &module) {
             auto &value = static_cast<value_type const &>(obj);
             return value.side;
           })
+      .def("astuple", &utils::astuple<ref_type>)
+      .def("asdict", &utils::asdict<ref_type>)
+      .def("write_into", &utils::write_into<ref_type>, pybind11::arg("array").noconvert(), pybind11::arg("row"))
       .def("__repr__", [](ref_type const &obj) {
         using namespace std::literals;
         auto &value = static_cast<value_type const &>(obj);
@@ -1447,6 +2125,30 @@ void utils::create_ref_struct<roq::CancelAllOrders>(pybind11::module_ &module) {
 
 // ...
 
+template <>
+struct utils::Fields<roq::CancelAllOrdersAck> final {
+  template <typename Callback>
+  static void apply(roq::CancelAllOrdersAck const &value, Callback &&callback) {
+    using namespace std::literals;
+    callback("stream_id"sv, value.stream_id);
+    callback("account"sv, value.account);
+    callback("order_id"sv, value.order_id);
+    callback("exchange"sv, value.exchange);
+    callback("symbol"sv, value.symbol);
+    callback("side"sv, value.side);
+    callback("origin"sv, value.origin);
+    callback("request_status"sv, value.request_status);
+    callback("error"sv, value.error);
+    callback("text"sv, value.text);
+    callback("request_id"sv, value.request_id);
+    callback("external_account"sv, value.external_account);
+    callback("number_of_affected_orders"sv, value.number_of_affected_orders);
+    callback("round_trip_latency"sv, value.round_trip_latency);
+    callback("user"sv, value.user);
+    callback("strategy_id"sv, value.strategy_id);
+  }
+};
+
 template <>
 void utils::create_ref_struct<roq::CancelAllOrdersAck>(pybind11::module_ &module) {
   using value_type = roq::CancelAllOrdersAck;
@@ -1537,6 +2239,12 @@ void utils::create_ref_struct<roq::CancelAllOrdersAck>(pybind11::module_ &module
             auto &value = static_cast<value_type const &>(obj);
             return value.round_trip_latency;
           })
+      .def_property_readonly(
+          "round_trip_latency_ns",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return utils::to_nanoseconds(value.round_trip_latency);
+          })
       .def_property_readonly(
           "user",
           [](ref_type const &obj) {
@@ -1549,6 +2257,9 @@ void utils::create_ref_struct<roq::CancelAllOrdersAck>(pybind11::module_ &module
             auto &value = static_cast<value_type const &>(obj);
             return value.strategy_id;
           })
+      .def("astuple", &utils::astuple<ref_type>)
+      .def("asdict", &utils::asdict<ref_type>)
+      .def("write_into", &utils::write_into<ref_type>, pybind11::arg("array").noconvert(), pybind11::arg("row"))
       .def("__repr__", [](ref_type const &obj) {
         using namespace std::literals;
         auto &value = static_cast<value_type const &>(obj);
@@ -1556,6 +2267,42 @@ void utils::create_ref_struct<roq::CancelAllOrdersAck>(pybind11::module_ &module
       });
 }
 
+template <>
+struct utils::Fields<roq::OrderAck> final {
+  template <typename Callback>
+  static void apply(roq::OrderAck const &value, Callback &&callback) {
+    using namespace std::literals;
+    callback("stream_id"sv, value.stream_id);
+    callback("account"sv, value.account);
+    callback("order_id"sv, value.order_id);
+    callback("exchange"sv, value.exchange);
+    callback("symbol"sv, value.symbol);
+    callback("side"sv, value.side);
+    callback("position_effect"sv, value.position_effect);
+    callback("margin_mode"sv, value.margin_mode);
+    callback("request_type"sv, value.request_type);
+    callback("origin"sv, value.origin);
+    callback("request_status"sv, value.request_status);
+    callback("error"sv, value.error);
+    callback("text"sv, value.text);
+    callback("request_id"sv, value.request_id);
+    callback("external_account"sv, value.external_account);
+    callback("external_order_id"sv, value.external_order_id);
+    callback("client_order_id"sv, value.client_order_id);
+    callback("quantity"sv, value.quantity);
+    callback("price"sv, value.price);
+    callback("stop_price"sv, value.stop_price);
+    callback("routing_id"sv, value.routing_id);
+    callback("version"sv, value.version);
+    callback("risk_exposure"sv, value.risk_exposure);
+    callback("risk_exposure_change"sv, value.risk_exposure_change);
+    callback("traded_quantity"sv, value.traded_quantity);
+    callback("round_trip_latency"sv, value.round_trip_latency);
+    callback("user"sv, value.user);
+    callback("strategy_id"sv, value.strategy_id);
+  }
+};
+
 template <>
 void utils::create_ref_struct<roq::OrderAck>(pybind11::module_ &module) {
   using value_type = roq::OrderAck;
@@ -1718,6 +2465,12 @@ void utils::create_ref_struct<roq::OrderAck>(pybind11::module_ &module) {
             auto &value = static_cast<value_type const &>(obj);
             return value.round_trip_latency;
           })
+      .def_property_readonly(
+          "round_trip_latency_ns",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return utils::to_nanoseconds(value.round_trip_latency);
+          })
       .def_property_readonly(
           "user",
           [](ref_type const &obj) {
@@ -1730,6 +2483,9 @@ void utils::create_ref_struct<roq::OrderAck>(pybind11::module_ &module) {
             auto &value = static_cast<value_type const &>(obj);
             return value.strategy_id;
           })
+      .def("astuple", &utils::astuple<ref_type>)
+      .def("asdict", &utils::asdict<ref_type>)
+      .def("write_into", &utils::write_into<ref_type>, pybind11::arg("array").noconvert(), pybind11::arg("row"))
       .def("__repr__", [](ref_type const &obj) {
         using namespace std::literals;
         auto &value = static_cast<value_type const &>(obj);
@@ -1737,6 +2493,51 @@ void utils::create_ref_struct<roq::OrderAck>(pybind11::module_ &module) {
       });
 }
 
+template <>
+struct utils::Fields<roq::OrderUpdate> final {
+  template <typename Callback>
+  static void apply(roq::OrderUpdate const &value, Callback &&callback) {
+    using namespace std::literals;
+    callback("stream_id"sv, value.stream_id);
+    callback("account"sv, value.account);
+    callback("order_id"sv, value.order_id);
+    callback("exchange"sv, value.exchange);
+    callback("symbol"sv, value.symbol);
+    callback("side"sv, value.side);
+    callback("position_effect"sv, value.position_effect);
+    callback("margin_mode"sv, value.margin_mode);
+    callback("max_show_quantity"sv, value.max_show_quantity);
+    callback("order_type"sv, value.order_type);
+    callback("time_in_force"sv, value.time_in_force);
+    callback("execution_instructions"sv, value.execution_instructions);
+    callback("create_time_utc"sv, value.create_time_utc);
+    callback("update_time_utc"sv, value.update_time_utc);
+    callback("external_account"sv, value.external_account);
+    callback("external_order_id"sv, value.external_order_id);
+    callback("client_order_id"sv, value.client_order_id);
+    callback("order_status"sv, value.order_status);
+    callback("quantity"sv, value.quantity);
+    callback("price"sv, value.price);
+    callback("stop_price"sv, value.stop_price);
+    callback("risk_exposure"sv, value.risk_exposure);
+    callback("risk_exposure_change"sv, value.risk_exposure_change);
+    callback("remaining_quantity"sv, value.remaining_quantity);
+    callback("traded_quantity"sv, value.traded_quantity);
+    callback("average_traded_price"sv, value.average_traded_price);
+    callback("last_traded_quantity"sv, value.last_traded_quantity);
+    callback("last_traded_price"sv, value.last_traded_price);
+    callback("last_liquidity"sv, value.last_liquidity);
+    callback("routing_id"sv, value.routing_id);
+    callback("max_request_version"sv, value.max_request_version);
+    callback("max_response_version"sv, value.max_response_version);
+    callback("max_accepted_version"sv, value.max_accepted_version);
+    callback("update_type"sv, value.update_type);
+    callback("sending_time_utc"sv, value.sending_time_utc);
+    callback("user"sv, value.user);
+    callback("strategy_id"sv, value.strategy_id);
+  }
+};
+
 template <>
 void utils::create_ref_struct<roq::OrderUpdate>(pybind11::module_ &module) {
   using value_type = roq::OrderUpdate;
@@ -1821,12 +2622,24 @@ void utils::create_ref_struct<roq::OrderUpdate>(pybind11::module_ &module) {
             auto &value = static_cast<value_type const &>(obj);
             return value.create_time_utc;
           })
+      .def_property_readonly(
+          "create_time_utc_ns",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return utils::to_nanoseconds(value.create_time_utc);
+          })
       .def_property_readonly(
           "update_time_utc",
           [](ref_type const &obj) {
             auto &value = static_cast<value_type const &>(obj);
             return value.update_time_utc;
           })
+      .def_property_readonly(
+          "update_time_utc_ns",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return utils::to_nanoseconds(value.update_time_utc);
+          })
       .def_property_readonly(
           "external_account",
           [](ref_type const &obj) {
@@ -1953,6 +2766,12 @@ void utils::create_ref_struct<roq::OrderUpdate>(pybind11::module_ &module) {
             auto &value = static_cast<value_type const &>(obj);
             return value.sending_time_utc;
           })
+      .def_property_readonly(
+          "sending_time_utc_ns",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return utils::to_nanoseconds(value.sending_time_utc);
+          })
       .def_property_readonly(
           "user",
           [](ref_type const &obj) {
@@ -1965,6 +2784,9 @@ void utils::create_ref_struct<roq::OrderUpdate>(pybind11::module_ &module) {
             auto &value = static_cast<value_type const &>(obj);
             return value.strategy_id;
           })
+      .def("astuple", &utils::astuple<ref_type>)
+      .def("asdict", &utils::asdict<ref_type>)
+      .def("write_into", &utils::write_into<ref_type>, pybind11::arg("array").noconvert(), pybind11::arg("row"))
       .def("__repr__", [](ref_type const &obj) {
         using namespace std::literals;
         auto &value = static_cast<value_type const &>(obj);
@@ -1972,6 +2794,32 @@ void utils::create_ref_struct<roq::OrderUpdate>(pybind11::module_ &module) {
       });
 }
 
+template <>
+struct utils::Fields<roq::TradeUpdate> final {
+  template <typename Callback>
+  static void apply(roq::TradeUpdate const &value, Callback &&callback) {
+    using namespace std::literals;
+    callback("stream_id"sv, value.stream_id);
+    callback("account"sv, value.account);
+    callback("order_id"sv, value.order_id);
+    callback("exchange"sv, value.exchange);
+    callback("symbol"sv, value.symbol);
+    callback("side"sv, value.side);
+    callback("position_effect"sv, value.position_effect);
+    callback("margin_mode"sv, value.margin_mode);
+    callback("create_time_utc"sv, value.create_time_utc);
+    callback("update_time_utc"sv, value.update_time_utc);
+    callback("external_account"sv, value.external_account);
+    callback("external_order_id"sv, value.external_order_id);
+    callback("fills"sv, value.fills);
+    callback("routing_id"sv, value.routing_id);
+    callback("update_type"sv, value.update_type);
+    callback("sending_time_utc"sv, value.sending_time_utc);
+    callback("user"sv, value.user);
+    callback("strategy_id"sv, value.strategy_id);
+  }
+};
+
 template <>
 void utils::create_ref_struct<roq::TradeUpdate>(pybind11::module_ &module) {
   using value_type = roq::TradeUpdate;
@@ -2032,12 +2880,24 @@ void utils::create_ref_struct<roq::TradeUpdate>(pybind11::module_ &module) {
             auto &value = static_cast<value_type const &>(obj);
             return value.create_time_utc;
           })
+      .def_property_readonly(
+          "create_time_utc_ns",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return utils::to_nanoseconds(value.create_time_utc);
+          })
       .def_property_readonly(
           "update_time_utc",
           [](ref_type const &obj) {
             auto &value = static_cast<value_type const &>(obj);
             return value.update_time_utc;
           })
+      .def_property_readonly(
+          "update_time_utc_ns",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return utils::to_nanoseconds(value.update_time_utc);
+          })
       .def_property_readonly(
           "external_account",
           [](ref_type const &obj) {
@@ -2052,10 +2912,10 @@ void utils::create_ref_struct<roq::TradeUpdate>(pybind11::module_ &module) {
           })
       .def_property_readonly(
           "fills",
-          [](ref_type const &obj) {
+          utils::create_view_getter([](ref_type const &obj) {
             auto &value = static_cast<value_type const &>(obj);
-            return utils::to_list(value.fills);
-          })
+            return utils::View<roq::Fill>{value.fills};
+          }))
       .def_property_readonly(
           "routing_id",
           [](ref_type const &obj) {
@@ -2074,6 +2934,12 @@ void utils::create_ref_struct<roq::TradeUpdate>(pybind11::module_ &module) {
             auto &value = static_cast<value_type const &>(obj);
             return value.sending_time_utc;
           })
+      .def_property_readonly(
+          "sending_time_utc_ns",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return utils::to_nanoseconds(value.sending_time_utc);
+          })
       .def_property_readonly(
           "user",
           [](ref_type const &obj) {
@@ -2086,6 +2952,9 @@ void utils::create_ref_struct<roq::TradeUpdate>(pybind11::module_ &module) {
             auto &value = static_cast<value_type const &>(obj);
             return value.strategy_id;
           })
+      .def("astuple", &utils::astuple<ref_type>)
+      .def("asdict", &utils::asdict<ref_type>)
+      .def("write_into", &utils::write_into<ref_type>, pybind11::arg("array").noconvert(), pybind11::arg("row"))
       .def("__repr__", [](ref_type const &obj) {
         using namespace std::literals;
         auto &value = static_cast<value_type const &>(obj);
@@ -2093,6 +2962,25 @@ void utils::create_ref_struct<roq::TradeUpdate>(pybind11::module_ &module) {
       });
 }
 
+template <>
+struct utils::Fields<roq::PositionUpdate> final {
+  template <typename Callback>
+  static void apply(roq::PositionUpdate const &value, Callback &&callback) {
+    using namespace std::literals;
+    callback("stream_id"sv, value.stream_id);
+    callback("account"sv, value.account);
+    callback("exchange"sv, value.exchange);
+    callback("symbol"sv, value.symbol);
+    callback("margin_mode"sv, value.margin_mode);
+    callback("external_account"sv, value.external_account);
+    callback("long_quantity"sv, value.long_quantity);
+    callback("short_quantity"sv, value.short_quantity);
+    callback("update_type"sv, value.update_type);
+    callback("exchange_time_utc"sv, value.exchange_time_utc);
+    callback("sending_time_utc"sv, value.sending_time_utc);
+  }
+};
+
 template <>
 void utils::create_ref_struct<roq::PositionUpdate>(pybind11::module_ &module) {
   using value_type = roq::PositionUpdate;
@@ -2159,12 +3047,27 @@ void utils::create_ref_struct<roq::PositionUpdate>(pybind11::module_ &module) {
             auto &value = static_cast<value_type const &>(obj);
             return value.exchange_time_utc;
           })
+      .def_property_readonly(
+          "exchange_time_utc_ns",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return utils::to_nanoseconds(value.exchange_time_utc);
+          })
       .def_property_readonly(
           "sending_time_utc",
           [](ref_type const &obj) {
             auto &value = static_cast<value_type const &>(obj);
             return value.sending_time_utc;
           })
+      .def_property_readonly(
+          "sending_time_utc_ns",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return utils::to_nanoseconds(value.sending_time_utc);
+          })
+      .def("astuple", &utils::astuple<ref_type>)
+      .def("asdict", &utils::asdict<ref_type>)
+      .def("write_into", &utils::write_into<ref_type>, pybind11::arg("array").noconvert(), pybind11::arg("row"))
       .def("__repr__", [](ref_type const &obj) {
         using namespace std::literals;
         auto &value = static_cast<value_type const &>(obj);
@@ -2172,6 +3075,24 @@ void utils::create_ref_struct<roq::PositionUpdate>(pybind11::module_ &module) {
       });
 }
 
+template <>
+struct utils::Fields<roq::FundsUpdate> final {
+  template <typename Callback>
+  static void apply(roq::FundsUpdate const &value, Callback &&callback) {
+    using namespace std::literals;
+    callback("stream_id"sv, value.stream_id);
+    callback("account"sv, value.account);
+    callback("currency"sv, value.currency);
+    callback("margin_mode"sv, value.margin_mode);
+    callback("balance"sv, value.balance);
+    callback("hold"sv, value.hold);
+    callback("external_account"sv, value.external_account);
+    callback("update_type"sv, value.update_type);
+    callback("exchange_time_utc"sv, value.exchange_time_utc);
+    callback("sending_time_utc"sv, value.sending_time_utc);
+  }
+};
+
 template <>
 void utils::create_ref_struct<roq::FundsUpdate>(pybind11::module_ &module) {
   using value_type = roq::FundsUpdate;
@@ -2232,12 +3153,27 @@ void utils::create_ref_struct<roq::FundsUpdate>(pybind11::module_ &module) {
             auto &value = static_cast<value_type const &>(obj);
             return value.exchange_time_utc;
           })
+      .def_property_readonly(
+          "exchange_time_utc_ns",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return utils::to_nanoseconds(value.exchange_time_utc);
+          })
       .def_property_readonly(
           "sending_time_utc",
           [](ref_type const &obj) {
             auto &value = static_cast<value_type const &>(obj);
             return value.sending_time_utc;
           })
+      .def_property_readonly(
+          "sending_time_utc_ns",
+          [](ref_type const &obj) {
+            auto &value = static_cast<value_type const &>(obj);
+            return utils::to_nanoseconds(value.sending_time_utc);
+          })
+      .def("astuple", &utils::astuple<ref_type>)
+      .def("asdict", &utils::asdict<ref_type>)
+      .def("write_into", &utils::write_into<ref_type>, pybind11::arg("array").noconvert(), pybind11::arg("row"))
       .def("__repr__", [](ref_type const &obj) {
         using namespace std::literals;
         auto &value = static_cast<value_type const &>(obj);
@@ -2247,6 +3183,20 @@ void utils::create_ref_struct<roq::FundsUpdate>(pybind11::module_ &module) {
 
 //
 
+template <>
+struct utils::Fields<roq::CustomMetricsUpdate> final {
+  template <typename Callback>
+  static void apply(roq::CustomMetricsUpdate const &value, Callback &&callback) {
+    using namespace std::literals;
+    callback("user"sv, value.user);
+    callback("label"sv, value.label);
+    callback("account"sv, value.account);
+    callback("exchange"sv, value.exchange);
+    callback("symbol"sv, value.symbol);
+    callback("measurements"sv, value.measurements);
+  }
+};
+
 template <>
 void utils::create_ref_struct<roq::CustomMetricsUpdate>(pybind11::module_ &module) {
   using value_type = roq::CustomMetricsUpdate;
@@ -2289,6 +3239,9 @@ void utils::create_ref_struct<roq::CustomMetricsUpdate>(pybind11::module_ &modul
             auto &value = static_cast<value_type const &>(obj);
             return utils::to_list(value.measurements);
           })
+      .def("astuple", &utils::astuple<ref_type>)
+      .def("asdict", &utils::asdict<ref_type>)
+      .def("write_into", &utils::write_into<ref_type>, pybind11::arg("array").noconvert(), pybind11::arg("row"))
       .def("__repr__", [](ref_type const &obj) {
         using namespace std::literals;
         auto &value = static_cast<value_type const &>(obj);
@@ -2296,5 +3249,58 @@ void utils::create_ref_struct<roq::CustomMetricsUpdate>(pybind11::module_ &modul
       });
 }
 
+// tools
+
+template <>
+void utils::create_struct<roq::python::Histogram>(pybind11::module_ &module) {
+  using value_type = roq::python::Histogram;
+  std::string name{nameof::nameof_short_type<value_type>()};
+  pybind11::class_<value_type>(module, name.c_str(), "Log-linear histogram")
+      .def_property_readonly("count", [](value_type const &value) { return value.count(); })
+      .def_property_readonly("min", [](value_type const &value) { return value.min(); })
+      .def_property_readonly("max", [](value_type const &value) { return value.max(); })
+      .def_property_readonly("mean", [](value_type const &value) { return value.mean(); })
+      .def(
+          "percentile",
+          [](value_type const &value, double q) { return value.percentile(q); },
+          pybind11::arg("q"),
+          "Percentile, q is [0, 100]")
+      .def(
+          "percentiles",
+          [](value_type const &value, std::vector<double> const &q) {
+            std::vector<uint64_t> result;
+            for (auto item : q)
+              result.emplace_back(value.percentile(item));
+            return result;
+          },
+          pybind11::arg("q") = std::vector<double>{50.0, 90.0, 99.0, 99.9},
+          "Percentiles, q is [0, 100]")
+      .def(
+          "buckets",
+          [](value_type const &value) {
+            std::vector<uint64_t> values, counts;
+            value.for_each([&](auto value, auto count) {
+              values.emplace_back(value);
+              counts.emplace_back(count);
+            });
+            pybind11::array_t<uint64_t> result_0{static_cast<pybind11::ssize_t>(std::size(values)), std::data(values)};
+            pybind11::array_t<uint64_t> result_1{static_cast<pybind11::ssize_t>(std::size(counts)), std::data(counts)};
+            return pybind11::make_tuple(result_0, result_1);
+          },
+          "Non-empty buckets as (lowest value, count) arrays")
+      .def("__repr__", [](value_type const &value) {
+        using namespace std::literals;
+        return fmt::format(
+            "Histogram(count={}, min={}, max={}, mean={:.1f}, p50={}, p99={}, p999={})"sv,
+            value.count(),
+            value.min(),
+            value.max(),
+            value.mean(),
+            value.percentile(50.0),
+            value.percentile(99.0),
+            value.percentile(99.9));
+      });
+}
+
 }  // namespace python
 }  // namespace roq
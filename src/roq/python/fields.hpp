@@ -0,0 +1,270 @@
+/* Copyright (c) 2017-2024, Hans Erik Thrane */
+
+#pragma once
+
+#include <pybind11/numpy.h>
+#include <pybind11/pybind11.h>
+
+#include <chrono>
+#include <cstring>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "roq/python/utils.hpp"
+
+namespace roq {
+namespace python {
+namespace utils {
+
+// note!
+//   bulk field access (one crossing instead of one property call per field)
+//   specializations must implement
+//     template <typename Callback>
+//     static void apply(T const &value, Callback &&callback);
+//   calling callback(name, field) for each field (same order as the properties)
+
+template <typename T>
+struct Fields;
+
+template <typename T>
+struct unref final {
+  using type = T;
+};
+
+template <typename T>
+struct unref<Ref<T>> final {
+  using type = T;
+};
+
+template <typename T>
+struct is_span final : std::false_type {};
+
+template <typename T, size_t N>
+struct is_span<std::span<T, N>> final : std::true_type {};
+
+template <typename T>
+struct is_duration final : std::false_type {};
+
+template <typename Rep, typename Period>
+struct is_duration<std::chrono::duration<Rep, Period>> final : std::true_type {};
+
+template <typename T>
+pybind11::object to_object(T const &value) {
+  if constexpr (is_span<T>::value) {
+    return to_list(value);
+  } else if constexpr (requires { to_int_flag(value); }) {
+    return pybind11::cast(to_int_flag(value));
+  } else {
+    return pybind11::cast(value);
+  }
+}
+
+template <typename T>
+pybind11::tuple astuple(T const &obj) {
+  using value_type = typename unref<T>::type;
+  auto &value = static_cast<value_type const &>(obj);
+  pybind11::list result;
+  Fields<value_type>::apply(value, [&]([[maybe_unused]] std::string_view const &name, auto const &field) {
+    result.append(to_object(field));
+  });
+  return pybind11::tuple{result};
+}
+
+template <typename T>
+pybind11::dict asdict(T const &obj) {
+  using value_type = typename unref<T>::type;
+  auto &value = static_cast<value_type const &>(obj);
+  pybind11::dict result;
+  Fields<value_type>::apply(value, [&](std::string_view const &name, auto const &field) {
+    result[pybind11::str{std::data(name), std::size(name)}] = to_object(field);
+  });
+  return result;
+}
+
+namespace detail {
+template <typename R, typename T>
+void store(std::byte *destination, T value) {
+  auto result = static_cast<R>(value);
+  std::memcpy(destination, &result, sizeof(result));
+}
+
+// note! resolved once per dtype (a field missing from the dtype is SKIP)
+struct Slot final {
+  enum class Type {
+    SKIP,
+    NATIVE,  // written directly
+    OBJECT,  // numpy item assignment
+  };
+  Type type = Type::SKIP;
+  size_t offset = {};
+  char kind = {};
+  size_t itemsize = {};
+  std::string name;
+};
+
+inline bool is_supported(char kind, size_t itemsize) {
+  switch (kind) {
+    case 'f':
+      return itemsize == 8 || itemsize == 4;
+    case 'i':
+    case 'm':
+    case 'M':
+    case 'u':
+      return itemsize == 8 || itemsize == 4 || itemsize == 2 || itemsize == 1;
+    case 'b':
+      return itemsize == 1;
+  }
+  return false;
+}
+
+// note! returns true if the field can be written directly into the dtype
+template <typename T>
+bool is_native(pybind11::dtype const &dtype) {
+  using namespace std::literals;
+  if (dtype.attr("byteorder").cast<std::string_view>() == ">"sv)
+    return false;
+  auto kind = dtype.kind();
+  if (!is_supported(kind, dtype.itemsize()))
+    return false;
+  if constexpr (std::is_floating_point<T>::value) {
+    return kind == 'f';
+  } else if constexpr (std::is_integral<T>::value) {
+    return kind != 'm' && kind != 'M';
+  } else if constexpr (std::is_enum<T>::value) {
+    return kind != 'f' && kind != 'm' && kind != 'M';
+  } else if constexpr (is_duration<T>::value) {
+    // note! datetime64 / timedelta64 must use nanosecond resolution
+    if (kind == 'm' || kind == 'M')
+      return pybind11::str(dtype).cast<std::string_view>().ends_with("[ns]"sv);
+    return true;
+  } else {
+    return false;
+  }
+}
+
+template <typename T>
+void write_native(std::byte *destination, Slot const &slot, T const &value) {
+  auto helper = [&](auto field) {
+    switch (slot.kind) {
+      case 'f':
+        if (slot.itemsize == 8)
+          store<double>(destination, field);
+        else
+          store<float>(destination, field);
+        break;
+      case 'i':
+      case 'm':
+      case 'M':
+        if (slot.itemsize == 8)
+          store<int64_t>(destination, field);
+        else if (slot.itemsize == 4)
+          store<int32_t>(destination, field);
+        else if (slot.itemsize == 2)
+          store<int16_t>(destination, field);
+        else
+          store<int8_t>(destination, field);
+        break;
+      case 'u':
+        if (slot.itemsize == 8)
+          store<uint64_t>(destination, field);
+        else if (slot.itemsize == 4)
+          store<uint32_t>(destination, field);
+        else if (slot.itemsize == 2)
+          store<uint16_t>(destination, field);
+        else
+          store<uint8_t>(destination, field);
+        break;
+      case 'b':
+        store<bool>(destination, field);
+        break;
+    }
+  };
+  if constexpr (std::is_enum<T>::value) {
+    helper(static_cast<std::underlying_type<T>::type>(value));
+  } else if constexpr (is_duration<T>::value) {
+    helper(to_nanoseconds(value));
+  } else if constexpr (std::is_arithmetic<T>::value) {
+    helper(value);
+  }
+}
+
+template <typename T>
+std::vector<Slot> resolve(pybind11::dtype const &dtype) {
+  std::vector<Slot> result;
+  auto fields = dtype.attr("fields").cast<pybind11::dict>();
+  Fields<T>::apply(T{}, [&](std::string_view const &name, auto const &field) {
+    using field_type = std::remove_cvref<decltype(field)>::type;
+    Slot slot{.name = std::string{name}};
+    pybind11::str key{std::data(name), std::size(name)};
+    if (fields.contains(key)) {
+      auto item = fields[key].cast<pybind11::tuple>();
+      auto field_dtype = item[0].cast<pybind11::dtype>();
+      slot.offset = item[1].cast<size_t>();
+      slot.kind = field_dtype.kind();
+      slot.itemsize = static_cast<size_t>(field_dtype.itemsize());
+      slot.type = is_native<field_type>(field_dtype) ? Slot::Type::NATIVE : Slot::Type::OBJECT;
+    }
+    result.emplace_back(std::move(slot));
+  });
+  return result;
+}
+
+// note!
+//   one cached layout per type (the last dtype seen), i.e. repeated writes into the same array are dict-free
+//   the dtype is kept alive (intentionally never released) so its address can't be reused
+template <typename T>
+std::vector<Slot> const &get_layout(pybind11::dtype const &dtype) {
+  static PyObject *cached = nullptr;
+  static std::vector<Slot> layout;
+  if (cached != dtype.ptr()) {
+    layout = resolve<T>(dtype);
+    Py_XDECREF(cached);
+    cached = dtype.inc_ref().ptr();
+  }
+  return layout;
+}
+}  // namespace detail
+
+// note!
+//   array must be a writeable structured (record) array
+//   fields are matched by name, fields missing from the dtype are ignored
+//   native scalars are written directly, everything else falls back to numpy item assignment
+//   the field layout is resolved once per dtype
+template <typename T>
+void write_into(T const &obj, pybind11::array array, size_t row) {
+  using namespace std::literals;
+  using value_type = typename unref<T>::type;
+  auto &value = static_cast<value_type const &>(obj);
+  auto dtype = array.dtype();
+  if (!dtype.has_fields())
+    throw std::invalid_argument{"Expected a structured array"s};
+  if (array.ndim() != 1)
+    throw std::invalid_argument{"Expected a one-dimensional array"s};
+  if (row >= static_cast<size_t>(array.shape(0)))
+    throw std::out_of_range{"Row is out of range"s};
+  auto &layout = detail::get_layout<value_type>(dtype);
+  auto record = static_cast<std::byte *>(array.mutable_data()) + static_cast<pybind11::ssize_t>(row) * array.strides(0);
+  size_t index = {};
+  Fields<value_type>::apply(value, [&]([[maybe_unused]] std::string_view const &name, auto const &field) {
+    auto &slot = layout[index++];
+    switch (slot.type) {
+      using enum detail::Slot::Type;
+      case SKIP:
+        break;
+      case NATIVE:
+        detail::write_native(record + slot.offset, slot, field);
+        break;
+      case OBJECT:
+        array[pybind11::int_(row)][pybind11::str{slot.name}] = to_object(field);
+        break;
+    }
+  });
+}
+
+}  // namespace utils
+}  // namespace python
+}  // namespace roq
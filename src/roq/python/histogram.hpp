@@ -0,0 +1,113 @@
+/* Copyright (c) 2017-2024, Hans Erik Thrane */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace roq {
+namespace python {
+
+// note!
+//   log-linear buckets (HDR style)
+//   values are grouped by power of two and each group is split into 2^PRECISION linear sub-buckets
+//   relative error is therefore bounded by 2^-PRECISION
+//   values larger than MAXIMUM are clamped (2^40 nanoseconds is ~18 minutes)
+
+struct Histogram final {
+  static constexpr size_t PRECISION = 5;
+  static constexpr size_t SUB_BUCKETS = size_t{1} << PRECISION;
+  static constexpr size_t MAXIMUM_BITS = 40;
+  static constexpr uint64_t MAXIMUM = (uint64_t{1} << MAXIMUM_BITS) - 1;
+  static constexpr size_t SIZE = (MAXIMUM_BITS - PRECISION + 1) * SUB_BUCKETS;
+
+  void operator()(int64_t value) { (*this)(static_cast<uint64_t>(std::max<int64_t>(value, 0))); }
+
+  void operator()(uint64_t value) {
+    value = std::min(value, MAXIMUM);
+    ++buckets_[index(value)];
+    ++count_;
+    sum_ += value;
+    min_ = std::min(min_, value);
+    max_ = std::max(max_, value);
+  }
+
+  void operator+=(Histogram const &other) {
+    for (size_t i = 0; i < SIZE; ++i)
+      buckets_[i] += other.buckets_[i];
+    count_ += other.count_;
+    sum_ += other.sum_;
+    min_ = std::min(min_, other.min_);
+    max_ = std::max(max_, other.max_);
+  }
+
+  void clear() { *this = {}; }
+
+  uint64_t count() const { return count_; }
+  uint64_t min() const { return count_ ? min_ : uint64_t{}; }
+  uint64_t max() const { return max_; }
+  double mean() const { return count_ ? static_cast<double>(sum_) / static_cast<double>(count_) : NaN; }
+
+  // note! q is [0, 100]
+  uint64_t percentile(double q) const {
+    if (!count_)
+      return {};
+    auto rank = static_cast<uint64_t>(std::ceil(std::clamp(q, 0.0, 100.0) / 100.0 * static_cast<double>(count_)));
+    rank = std::max<uint64_t>(rank, 1);
+    uint64_t total = {};
+    for (size_t i = 0; i < SIZE; ++i) {
+      total += buckets_[i];
+      if (total >= rank)
+        return std::clamp(highest_equivalent_value(i), min_, max_);
+    }
+    return max_;
+  }
+
+  // note! only non-empty buckets (lowest value of each bucket)
+  template <typename Callback>
+  void for_each(Callback &&callback) const {
+    for (size_t i = 0; i < SIZE; ++i)
+      if (buckets_[i])
+        callback(lowest_equivalent_value(i), buckets_[i]);
+  }
+
+  static constexpr size_t index(uint64_t value) {
+    if (value < SUB_BUCKETS)
+      return static_cast<size_t>(value);
+    auto shift = static_cast<size_t>(std::bit_width(value)) - 1 - PRECISION;
+    return (shift + 1) * SUB_BUCKETS + static_cast<size_t>(value >> shift) - SUB_BUCKETS;
+  }
+
+  static constexpr uint64_t lowest_equivalent_value(size_t index) {
+    if (index < SUB_BUCKETS)
+      return index;
+    auto shift = index / SUB_BUCKETS - 1;
+    return (SUB_BUCKETS + index % SUB_BUCKETS) << shift;
+  }
+
+  static constexpr uint64_t highest_equivalent_value(size_t index) {
+    if (index < SUB_BUCKETS)
+      return index;
+    auto shift = index / SUB_BUCKETS - 1;
+    return lowest_equivalent_value(index) + (uint64_t{1} << shift) - 1;
+  }
+
+ private:
+  static constexpr double NaN = std::numeric_limits<double>::quiet_NaN();
+
+  std::array<uint64_t, SIZE> buckets_ = {};
+  uint64_t count_ = {};
+  uint64_t sum_ = {};
+  uint64_t min_ = std::numeric_limits<uint64_t>::max();
+  uint64_t max_ = {};
+};
+
+}  // namespace python
+}  // namespace roq
@@ -5,6 +5,7 @@
 #include "roq/python/io/module.hpp"
 
 #include "roq/python/io/net/module.hpp"
+#include "roq/python/io/pcap/module.hpp"
 
 using namespace std::literals;
 
@@ -15,6 +16,8 @@ namespace io {
 void Module::create(pybind11::module_ &module) {
   auto net = module.def_submodule("net");
   roq::python::io::net::Module::create(net);
+  auto pcap = module.def_submodule("pcap");
+  roq::python::io::pcap::Module::create(pcap);
 }
 
 }  // namespace io
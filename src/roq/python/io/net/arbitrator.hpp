@@ -0,0 +1,176 @@
+/* Copyright (c) 2017-2024, Hans Erik Thrane */
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#include "roq/io/net/reorder_buffer.hpp"
+
+namespace roq {
+namespace python {
+namespace io {
+namespace net {
+
+// note!
+//   line arbitration for feeds published on identical (A/B) lines
+//   the first copy of each sequence number is forwarded to the reorder buffer, i.e. always the faster line
+//   later copies are dropped (a sliding window of recently seen sequence numbers is used)
+//   per-line statistics: packets, wins (first copy) and gaps (missing sequence numbers on that line)
+//   a gap is counted when a line moves forward, it is un-counted if a late packet later fills it
+//   a line moving backwards by more than the window is a restart, all state is reset if the arbitrator agrees
+//   the window must cover the maximum skew between lines (a lagging line is otherwise dropped as duplicates)
+
+struct Arbitrator final {
+  struct Options final {
+    size_t lines = 2;
+    size_t window = 4096;  // number of sequence numbers remembered (duplicate detection)
+    size_t depth = 8;      // reorder buffer
+    size_t maximum_packet_size = 4096;
+  };
+
+  struct Line final {
+    size_t packets = {};
+    size_t wins = {};
+    size_t gaps = {};
+    uint64_t last_sequence_number = {};
+  };
+
+  explicit Arbitrator(Options const &options)
+      : options_{options}, reorder_buffer_{create_reorder_buffer(options_)}, lines_(options.lines),
+        windows_(options.lines, Window{options.window}), seen_{options.window} {
+    using namespace std::literals;
+    if (!options.lines || !options.window)
+      throw std::invalid_argument{"Invalid options"s};
+  }
+
+  // note! returns true if the packet was forwarded (first copy)
+  bool dispatch(
+      roq::io::net::ReorderBuffer::Handler &handler,
+      size_t line,
+      std::span<std::byte const> const &payload,
+      uint64_t sequence_number) {
+    using namespace std::literals;
+    if (line >= std::size(lines_))
+      throw std::out_of_range{"Line is out of range"s};
+    auto &line_2 = lines_[line];
+    auto &window = windows_[line];
+    ++line_2.packets;
+    if (window.stale(sequence_number)) {
+      window.clear();
+      // note! the other lines may already have moved the arbitrator past the restart
+      if (seen_.stale(sequence_number)) {
+        reset();
+        handler(roq::io::net::ReorderBuffer::Reset{});
+      }
+    }
+    auto initialized = window.initialized();
+    auto maximum = window.maximum();
+    if (window.insert(sequence_number) && initialized) {
+      if (sequence_number > maximum)
+        line_2.gaps += sequence_number - maximum - 1;
+      else if (sequence_number > window.first() && line_2.gaps)
+        --line_2.gaps;  // note! late packet filled a gap which has already been counted
+    }
+    line_2.last_sequence_number = window.maximum();
+    if (!seen_.insert(sequence_number)) {
+      ++duplicates_;
+      return false;
+    }
+    ++line_2.wins;
+    ++forwarded_;
+    (*reorder_buffer_).dispatch(handler, payload);
+    return true;
+  }
+
+  // note! forgets all sequence numbers and drops packets held by the reorder buffer (statistics are kept)
+  void reset() {
+    reorder_buffer_ = create_reorder_buffer(options_);
+    for (auto &window : windows_)
+      window.clear();
+    seen_.clear();
+    ++resets_;
+  }
+
+  std::span<Line const> lines() const { return lines_; }
+
+  size_t forwarded() const { return forwarded_; }
+  size_t duplicates() const { return duplicates_; }
+  size_t resets() const { return resets_; }
+
+ protected:
+  // note! sliding window of recently seen sequence numbers
+  struct Window final {
+    explicit Window(size_t size) : seen_(size) {}
+
+    bool initialized() const { return initialized_; }
+    uint64_t first() const { return first_; }
+    uint64_t maximum() const { return maximum_; }
+
+    // note! returns true if the sequence number is older than the window
+    bool stale(uint64_t sequence_number) const {
+      return initialized_ && sequence_number < maximum_ && (maximum_ - sequence_number) >= std::size(seen_);
+    }
+
+    // note! returns false if the sequence number has already been seen (or is older than the window)
+    bool insert(uint64_t sequence_number) {
+      auto window = std::size(seen_);
+      if (!initialized_) {
+        initialized_ = true;
+        first_ = sequence_number;
+        maximum_ = sequence_number;
+      } else if (sequence_number > maximum_) {
+        auto count = std::min<uint64_t>(sequence_number - maximum_, window);
+        for (uint64_t i = 1; i <= count; ++i)
+          seen_[(maximum_ + i) % window] = false;
+        maximum_ = sequence_number;
+      } else if (stale(sequence_number) || seen_[sequence_number % window]) {
+        return false;
+      }
+      seen_[sequence_number % window] = true;
+      return true;
+    }
+
+    void clear() {
+      std::fill(std::begin(seen_), std::end(seen_), false);
+      initialized_ = false;
+      first_ = {};
+      maximum_ = {};
+    }
+
+   private:
+    std::vector<bool> seen_;
+    bool initialized_ = false;
+    uint64_t first_ = {};
+    uint64_t maximum_ = {};
+  };
+
+  static std::unique_ptr<roq::io::net::ReorderBuffer> create_reorder_buffer(Options const &options) {
+    return roq::io::net::ReorderBuffer::create(roq::io::net::ReorderBuffer::Options{
+        .depth = options.depth,
+        .maximum_packet_size = options.maximum_packet_size,
+        .maximum_sequence_number = std::numeric_limits<uint64_t>::max(),
+        .minimum_sequence_number = {},
+    });
+  }
+
+ private:
+  Options const options_;
+  std::unique_ptr<roq::io::net::ReorderBuffer> reorder_buffer_;
+  std::vector<Line> lines_;
+  std::vector<Window> windows_;
+  Window seen_;
+  size_t forwarded_ = {};
+  size_t duplicates_ = {};
+  size_t resets_ = {};
+};
+
+}  // namespace net
+}  // namespace io
+}  // namespace python
+}  // namespace roq
@@ -6,12 +6,20 @@
 
 #include <pybind11/chrono.h>
 #include <pybind11/functional.h>
+#include <pybind11/numpy.h>
 #include <pybind11/stl.h>
 
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <vector>
+
 #include "roq/python/utils.hpp"
 
 #include "roq/io/net/reorder_buffer.hpp"
 
+#include "roq/python/io/net/arbitrator.hpp"
+
 using namespace std::literals;
 
 namespace roq {
@@ -20,25 +28,173 @@ namespace python {
 namespace io {
 namespace net {
 
-auto const DEFAULT_REORDER_BUFFER_OPTIONS = roq::io::net::ReorderBuffer::Options{
-    .depth = 8,
-    .maximum_packet_size = 4096,
-    .maximum_sequence_number = std::numeric_limits<uint64_t>::max(),
-    .minimum_sequence_number = {},
+// note! released packets are either the current packet or the oldest held packet (whichever is lower)
+
+struct ReorderBuffer::Tracker final : public value_type::Handler {
+  Tracker(ReorderBuffer &reorder_buffer, value_type::Handler &handler, uint64_t sequence_number)
+      : reorder_buffer_{reorder_buffer}, handler_{handler}, sequence_number_{sequence_number} {}
+
+  bool released() const { return released_; }
+  bool reset() const { return reset_; }
+
+ protected:
+  uint64_t operator()(value_type::GetSequenceNumber const &get_sequence_number) override {
+    return handler_(get_sequence_number);
+  }
+
+  void operator()(value_type::Parse const &parse) override {
+    auto &held = reorder_buffer_.held_;
+    uint64_t sequence_number = {};
+    if (!released_ && (held.empty() || sequence_number_ < held.front().sequence_number)) {
+      released_ = true;
+      sequence_number = sequence_number_;
+    } else if (!held.empty()) {
+      auto &item = held.front();
+      sequence_number = item.sequence_number;
+      auto latency = std::chrono::steady_clock::now() - item.received;
+      reorder_buffer_.latency_(std::chrono::duration_cast<std::chrono::nanoseconds>(latency).count());
+      held.pop_front();
+    }
+    auto &next_sequence_number = reorder_buffer_.next_sequence_number_;
+    if (reorder_buffer_.initialized_ && sequence_number > next_sequence_number)
+      reorder_buffer_.statistics_.gaps += sequence_number - next_sequence_number;
+    reorder_buffer_.initialized_ = true;
+    next_sequence_number = sequence_number + 1;
+    handler_(parse);
+  }
+
+  void operator()(value_type::Reset const &reset) override {
+    reset_ = true;
+    ++reorder_buffer_.statistics_.resets;
+    handler_(reset);
+  }
+
+ private:
+  ReorderBuffer &reorder_buffer_;
+  value_type::Handler &handler_;
+  uint64_t const sequence_number_;
+  bool released_ = false;
+  bool reset_ = false;
 };
 
-ReorderBuffer::ReorderBuffer() : reorder_buffer_{roq::io::net::ReorderBuffer::create(DEFAULT_REORDER_BUFFER_OPTIONS)} {
+ReorderBuffer::ReorderBuffer(value_type::Options const &options)
+    : options_{options}, reorder_buffer_{value_type::create(options_)}, held_{options_.depth + 1} {
+}
+
+void ReorderBuffer::dispatch(
+    value_type::Handler &handler, std::span<std::byte const> const &payload, uint64_t sequence_number) {
+  ++statistics_.packets;
+  auto backward = initialized_ && sequence_number < next_sequence_number_;
+  auto held = held_.contains(sequence_number);
+  Tracker tracker{*this, handler, sequence_number};
+  (*reorder_buffer_).dispatch(tracker, payload);
+  if (tracker.released()) {
+    // note! restart, held packets belong to the previous sequence and will never be released
+    if (backward)
+      held_.clear();
+  } else if (backward || held) {
+    ++statistics_.duplicates;
+  } else {
+    ++statistics_.reordered;
+    held_.insert(sequence_number, std::chrono::steady_clock::now());
+    statistics_.max_held = std::max(statistics_.max_held, held_.size());
+  }
+  // note! held packets discarded by a reset are never released
+  if (tracker.reset())
+    while (!held_.empty() && held_.front().sequence_number < next_sequence_number_)
+      held_.pop_front();
+  while (held_.size() > options_.depth)
+    held_.pop_front();
 }
 
 }  // namespace net
 }  // namespace io
 
+namespace {
+struct Handler final : public roq::io::net::ReorderBuffer::Handler {
+  Handler(
+      uint64_t sequence_number,
+      std::function<void(pybind11::bytes const &)> const &parse,
+      std::function<void()> const &reset)
+      : sequence_number_{sequence_number}, parse_{parse}, reset_{reset} {}
+
+  uint64_t operator()(roq::io::net::ReorderBuffer::GetSequenceNumber const &) override { return sequence_number_; }
+  void operator()(roq::io::net::ReorderBuffer::Parse const &parse) override {
+    pybind11::bytes arg0{reinterpret_cast<char const *>(std::data(parse.payload)), std::size(parse.payload)};
+    parse_(arg0);
+  }
+  void operator()(roq::io::net::ReorderBuffer::Reset const &) override { reset_(); }
+
+ private:
+  uint64_t const sequence_number_;
+  std::function<void(pybind11::bytes const &)> const &parse_;
+  std::function<void()> const &reset_;
+};
+
+// note! re-used for all packets of a batch, parse is called with the released payload (a span)
+template <typename Parse>
+struct BatchHandler final : public roq::io::net::ReorderBuffer::Handler {
+  BatchHandler(Parse const &parse, pybind11::object const &reset) : parse_{parse}, reset_{reset} {}
+
+  uint64_t operator()(roq::io::net::ReorderBuffer::GetSequenceNumber const &) override { return sequence_number; }
+  void operator()(roq::io::net::ReorderBuffer::Parse const &parse) override { parse_(parse.payload); }
+  void operator()(roq::io::net::ReorderBuffer::Reset const &) override {
+    if (!reset_.is_none())
+      reset_();
+  }
+
+  uint64_t sequence_number = {};
+
+ private:
+  Parse const &parse_;
+  pybind11::object const &reset_;
+};
+
+template <typename Parse>
+void dispatch_many(
+    roq::python::io::net::ReorderBuffer &reorder_buffer,
+    pybind11::sequence const &buffers,
+    pybind11::array_t<uint64_t, pybind11::array::c_style | pybind11::array::forcecast> const &sequence_numbers,
+    Parse const &parse,
+    pybind11::object const &reset) {
+  if (std::size(buffers) != static_cast<size_t>(sequence_numbers.size()))
+    throw std::invalid_argument{"Buffers and sequence numbers must have the same size"s};
+  BatchHandler handler{parse, reset};
+  auto sequence_numbers_2 = sequence_numbers.data();
+  for (size_t i = 0; i < std::size(buffers); ++i) {
+    auto buffer = buffers[i].cast<pybind11::buffer>();
+    auto info = buffer.request();
+    if (info.itemsize != 1 || info.ndim != 1 || info.strides[0] != 1)
+      throw std::invalid_argument{"Expected a contiguous byte buffer"s};
+    std::span data{static_cast<std::byte const *>(info.ptr), static_cast<size_t>(info.size)};
+    handler.sequence_number = sequence_numbers_2[i];
+    reorder_buffer.dispatch(handler, data, handler.sequence_number);
+  }
+}
+}  // namespace
+
 template <>
 void utils::create_struct<roq::python::io::net::ReorderBuffer>(pybind11::module_ &module) {
   using value_type = roq::python::io::net::ReorderBuffer;
   std::string name{nameof::nameof_short_type<value_type>()};
   pybind11::class_<value_type>(module, name.c_str())
-      .def(pybind11::init<>())
+      .def(
+          pybind11::init([](size_t depth,
+                            size_t maximum_packet_size,
+                            uint64_t maximum_sequence_number,
+                            uint64_t minimum_sequence_number) {
+            auto options = value_type::value_type::Options{
+                .depth = depth,
+                .maximum_packet_size = maximum_packet_size,
+                .maximum_sequence_number = maximum_sequence_number,
+                .minimum_sequence_number = minimum_sequence_number,
+            };
+            return std::make_unique<value_type>(options);
+          }),
+          pybind11::arg("depth") = 8,
+          pybind11::arg("maximum_packet_size") = 4096,
+          pybind11::arg("maximum_sequence_number") = std::numeric_limits<uint64_t>::max(),
+          pybind11::arg("minimum_sequence_number") = 0)
       .def(
           "dispatch",
           [](value_type &self,
@@ -46,36 +202,150 @@ void utils::create_struct<roq::python::io::net::ReorderBuffer>(pybind11::module_
              uint64_t sequence_number,
              std::function<void(pybind11::bytes const &)> const &parse,
              std::function<void()> const &reset) {
-            struct MyHandler final : public roq::io::net::ReorderBuffer::Handler {
-              explicit MyHandler(
-                  uint64_t sequence_number,
-                  std::function<void(pybind11::bytes const &)> const &parse,
-                  std::function<void()> const &reset)
-                  : sequence_number_{sequence_number}, parse_{parse}, reset_{reset} {}
-
-              uint64_t operator()(roq::io::net::ReorderBuffer::GetSequenceNumber const &) override {
-                return sequence_number_;
-              }
-              void operator()(roq::io::net::ReorderBuffer::Parse const &parse) override {
-                pybind11::bytes arg0{
-                    reinterpret_cast<char const *>(std::data(parse.payload)), std::size(parse.payload)};
-                parse_(arg0);
-              }
-              void operator()(roq::io::net::ReorderBuffer::Reset const &) override { reset_(); }
-
-             private:
-              uint64_t const sequence_number_;
-              std::function<void(pybind11::bytes const &)> const &parse_;
-              std::function<void()> const &reset_;
-            } handler{sequence_number, parse, reset};
+            Handler handler{sequence_number, parse, reset};
             auto data_1 = static_cast<std::string_view>(data);
             std::span data_2{reinterpret_cast<std::byte const *>(std::data(data_1)), std::size(data_1)};
-            static_cast<value_type::value_type &>(self).dispatch(handler, data_2);
+            self.dispatch(handler, data_2, sequence_number);
           },
           pybind11::arg("data"),
           pybind11::arg("sequence_number"),
           pybind11::arg("parse"),
-          pybind11::arg("reset"));
+          pybind11::arg("reset"))
+      // note! the payload is copied (bytes), a view could outlive the packet (dispatch_into avoids the python calls)
+      .def(
+          "dispatch_many",
+          [](value_type &self,
+             pybind11::sequence const &buffers,
+             pybind11::array_t<uint64_t, pybind11::array::c_style | pybind11::array::forcecast> const &sequence_numbers,
+             pybind11::function const &parse,
+             pybind11::object const &reset) {
+            auto parse_2 = [&](std::span<std::byte const> const &payload) {
+              pybind11::bytes arg0{reinterpret_cast<char const *>(std::data(payload)), std::size(payload)};
+              parse(arg0);
+            };
+            dispatch_many(self, buffers, sequence_numbers, parse_2, reset);
+          },
+          pybind11::arg("buffers"),
+          pybind11::arg("sequence_numbers"),
+          pybind11::arg("parse"),
+          pybind11::arg("reset") = pybind11::none(),
+          "Dispatch many packets, parse is called with the payload (bytes)")
+      // note! no python call per packet, released payloads are appended to output
+      .def(
+          "dispatch_into",
+          [](value_type &self,
+             pybind11::sequence const &buffers,
+             pybind11::array_t<uint64_t, pybind11::array::c_style | pybind11::array::forcecast> const &sequence_numbers,
+             pybind11::bytearray const &output,
+             pybind11::object const &reset) {
+            std::vector<int64_t> offsets, lengths;
+            auto parse = [&](std::span<std::byte const> const &payload) {
+              auto offset = PyByteArray_Size(output.ptr());
+              if (PyByteArray_Resize(output.ptr(), offset + static_cast<Py_ssize_t>(std::size(payload))) < 0)
+                throw pybind11::error_already_set{};
+              std::memcpy(PyByteArray_AsString(output.ptr()) + offset, std::data(payload), std::size(payload));
+              offsets.emplace_back(offset);
+              lengths.emplace_back(std::size(payload));
+            };
+            // note! output is restored to its original size if an exception is thrown
+            auto size = PyByteArray_Size(output.ptr());
+            try {
+              dispatch_many(self, buffers, sequence_numbers, parse, reset);
+            } catch (...) {
+              if (PyByteArray_Resize(output.ptr(), size) < 0)
+                PyErr_Clear();  // note! e.g. exported buffer, the original exception is more useful
+              throw;
+            }
+            pybind11::array_t<int64_t> result_0{static_cast<pybind11::ssize_t>(std::size(offsets)), std::data(offsets)};
+            pybind11::array_t<int64_t> result_1{static_cast<pybind11::ssize_t>(std::size(lengths)), std::data(lengths)};
+            return pybind11::make_tuple(result_0, result_1);
+          },
+          pybind11::arg("buffers"),
+          pybind11::arg("sequence_numbers"),
+          pybind11::arg("output"),
+          pybind11::arg("reset") = pybind11::none(),
+          "Dispatch many packets, released payloads are appended to output (a bytearray), returns (offsets, lengths)")
+      .def_property_readonly("depth", [](value_type const &self) { return self.options().depth; })
+      .def_property_readonly(
+          "maximum_packet_size", [](value_type const &self) { return self.options().maximum_packet_size; })
+      .def(
+          "statistics",
+          [](value_type const &self) {
+            auto &statistics = self.statistics();
+            pybind11::dict result;
+            result["packets"] = statistics.packets;
+            result["reordered"] = statistics.reordered;
+            result["duplicates"] = statistics.duplicates;
+            result["gaps"] = statistics.gaps;
+            result["resets"] = statistics.resets;
+            result["max_held"] = statistics.max_held;
+            return result;
+          },
+          "Counters {packets, reordered, duplicates, gaps, resets, max_held}")
+      .def(
+          "latency",
+          [](value_type const &self) { return self.latency(); },
+          "Time held packets spent in the buffer (nanoseconds)");
+}
+
+template <>
+void utils::create_struct<roq::python::io::net::Arbitrator>(pybind11::module_ &module) {
+  using value_type = roq::python::io::net::Arbitrator;
+  std::string name{nameof::nameof_short_type<value_type>()};
+  pybind11::class_<value_type>(module, name.c_str(), "Arbitrates identical (A/B) lines into a reorder buffer")
+      .def(
+          pybind11::init([](size_t lines, size_t window, size_t depth, size_t maximum_packet_size) {
+            auto options = value_type::Options{
+                .lines = lines,
+                .window = window,
+                .depth = depth,
+                .maximum_packet_size = maximum_packet_size,
+            };
+            return std::make_unique<value_type>(options);
+          }),
+          pybind11::arg("lines") = 2,
+          pybind11::arg("window") = 4096,
+          pybind11::arg("depth") = 8,
+          pybind11::arg("maximum_packet_size") = 4096)
+      .def(
+          "dispatch",
+          [](value_type &self,
+             size_t line,
+             pybind11::bytes data,
+             uint64_t sequence_number,
+             std::function<void(pybind11::bytes const &)> const &parse,
+             std::function<void()> const &reset) {
+            Handler handler{sequence_number, parse, reset};
+            auto data_1 = static_cast<std::string_view>(data);
+            std::span data_2{reinterpret_cast<std::byte const *>(std::data(data_1)), std::size(data_1)};
+            return self.dispatch(handler, line, data_2, sequence_number);
+          },
+          pybind11::arg("line"),
+          pybind11::arg("data"),
+          pybind11::arg("sequence_number"),
+          pybind11::arg("parse"),
+          pybind11::arg("reset"),
+          "Returns True if this was the first copy (forwarded to the reorder buffer)")
+      .def("reset", [](value_type &self) { self.reset(); }, "Forget all sequence numbers (e.g. after a feed restart)")
+      .def_property_readonly("forwarded", [](value_type const &self) { return self.forwarded(); })
+      .def_property_readonly("duplicates", [](value_type const &self) { return self.duplicates(); })
+      .def_property_readonly("resets", [](value_type const &self) { return self.resets(); })
+      .def_property_readonly(
+          "lines",
+          [](value_type const &self) {
+            pybind11::list result;
+            for (auto &line : self.lines()) {
+              pybind11::dict item;
+              item["packets"] = line.packets;
+              item["wins"] = line.wins;
+              item["gaps"] = line.gaps;
+              auto packets = static_cast<double>(line.packets);
+              item["win_rate"] = line.packets ? static_cast<double>(line.wins) / packets : 0.0;
+              result.append(item);
+            }
+            return result;
+          },
+          "Per-line statistics, [{packets, wins, gaps, win_rate}]");
 }
 
 }  // namespace python
@@ -2,24 +2,119 @@
 
 #pragma once
 
+#include <chrono>
+#include <cstdint>
 #include <memory>
+#include <span>
+#include <vector>
 
 #include "roq/io/net/reorder_buffer.hpp"
 
+#include "roq/python/histogram.hpp"
+
 namespace roq {
 namespace python {
 namespace io {
 namespace net {
 
+// note!
+//   counters are derived from the packets passing through dispatch (the reorder buffer releases in sequence order)
+//   reordered means a packet was held (arrived ahead of a missing sequence number)
+//   gaps is the number of sequence numbers never released (given up after a reset)
+//   latency is the time (nanoseconds) a held packet spent in the buffer
+//   limits:
+//     the wrapped reorder buffer is opaque, i.e. the counters are inferred from what it releases
+//     a packet below the next sequence number is a duplicate unless it is released (a restart)
+//     held packets dropped by a reset (or beyond depth) are only reflected by gaps, they have no latency
+
 struct ReorderBuffer final {
   using value_type = roq::io::net::ReorderBuffer;
 
-  ReorderBuffer();
+  struct Statistics final {
+    size_t packets = {};
+    size_t reordered = {};
+    size_t duplicates = {};
+    size_t gaps = {};
+    size_t resets = {};
+    size_t max_held = {};
+  };
+
+  explicit ReorderBuffer(value_type::Options const &);
 
   operator value_type &() { return *reorder_buffer_; }
 
+  void dispatch(value_type::Handler &, std::span<std::byte const> const &payload, uint64_t sequence_number);
+
+  value_type::Options const &options() const { return options_; }
+  Statistics const &statistics() const { return statistics_; }
+  Histogram const &latency() const { return latency_; }
+
+ protected:
+  struct Tracker;
+
+  // note! fixed capacity ring of held packets, sorted by sequence number (the oldest is at the front)
+  struct Held final {
+    struct Item final {
+      uint64_t sequence_number = {};
+      std::chrono::steady_clock::time_point received;
+    };
+
+    explicit Held(size_t capacity) : items_(capacity) {}
+
+    bool empty() const { return !size_; }
+    size_t size() const { return size_; }
+
+    Item const &front() const { return items_[head_]; }
+
+    bool contains(uint64_t sequence_number) const {
+      for (size_t i = 0; i < size_; ++i)
+        if (at(i).sequence_number == sequence_number)
+          return true;
+      return false;
+    }
+
+    // note! the oldest item is dropped when full
+    void insert(uint64_t sequence_number, std::chrono::steady_clock::time_point received) {
+      if (size_ == std::size(items_))
+        pop_front();
+      auto index = size_;
+      for (; index > 0 && sequence_number < at(index - 1).sequence_number; --index)
+        at(index) = at(index - 1);
+      at(index) = {
+          .sequence_number = sequence_number,
+          .received = received,
+      };
+      ++size_;
+    }
+
+    void pop_front() {
+      head_ = (head_ + 1) % std::size(items_);
+      --size_;
+    }
+
+    void clear() {
+      head_ = {};
+      size_ = {};
+    }
+
+   protected:
+    Item &at(size_t index) { return items_[(head_ + index) % std::size(items_)]; }
+    Item const &at(size_t index) const { return items_[(head_ + index) % std::size(items_)]; }
+
+   private:
+    std::vector<Item> items_;
+    size_t head_ = {};
+    size_t size_ = {};
+  };
+
  private:
+  value_type::Options const options_;
   std::unique_ptr<value_type> reorder_buffer_;
+  Statistics statistics_;
+  Histogram latency_;
+  Held held_;
+  bool initialized_ = false;
+  uint64_t next_sequence_number_ = {};
 };
 
 }  // namespace net
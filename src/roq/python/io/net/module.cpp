@@ -6,6 +6,7 @@
 
 #include "roq/python/utils.hpp"
 
+#include "roq/python/io/net/arbitrator.hpp"
 #include "roq/python/io/net/details.hpp"
 
 using namespace std::literals;
@@ -17,6 +18,7 @@ namespace net {
 
 void Module::create(pybind11::module_ &module) {
   roq::python::utils::create_struct<roq::python::io::net::ReorderBuffer>(module);
+  roq::python::utils::create_struct<roq::python::io::net::Arbitrator>(module);
 }
 
 }  // namespace net
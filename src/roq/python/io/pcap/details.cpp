@@ -0,0 +1,72 @@
+/* Copyright (c) 2017-2024, Hans Erik Thrane */
+
+#define PYBIND11_DETAILED_ERROR_MESSAGES
+
+#include <pybind11/numpy.h>
+#include <pybind11/stl.h>
+
+#include <vector>
+
+#include "roq/python/utils.hpp"
+
+#include "roq/python/io/pcap/reader.hpp"
+
+using namespace std::literals;
+
+namespace roq {
+namespace python {
+
+template <>
+void utils::create_struct<roq::python::io::pcap::Reader>(pybind11::module_ &module) {
+  using value_type = roq::python::io::pcap::Reader;
+  std::string name{nameof::nameof_short_type<value_type>()};
+  pybind11::class_<value_type>(module, name.c_str(), "Reads udp datagrams from a pcap or pcapng capture file")
+      .def(
+          pybind11::init([](std::string_view const &path) { return std::make_unique<value_type>(path); }),
+          pybind11::arg("path"))
+      .def_property_readonly("skipped", [](value_type const &self) { return self.skipped(); })
+      // note! no copy, the array keeps the reader (and the memory map) alive
+      .def_property_readonly(
+          "data",
+          [](pybind11::object const &self) {
+            auto data = self.cast<value_type const &>().data();
+            return pybind11::array_t<uint8_t>(
+                std::size(data), reinterpret_cast<uint8_t const *>(std::data(data)), self);
+          })
+      .def(
+          "read",
+          [](value_type &self, std::vector<uint16_t> const &ports) {
+            std::vector<int64_t> timestamp, offset, length;
+            std::vector<uint16_t> source_port, destination_port;
+            auto begin = std::data(self.data());
+            {
+              pybind11::gil_scoped_release release;
+              self.dispatch(
+                  [&](auto &packet) {
+                    timestamp.emplace_back(packet.timestamp.count());
+                    source_port.emplace_back(packet.source_port);
+                    destination_port.emplace_back(packet.destination_port);
+                    offset.emplace_back(std::data(packet.payload) - begin);
+                    length.emplace_back(std::size(packet.payload));
+                  },
+                  ports);
+            }
+            auto helper = [](auto &values) {
+              using type = std::remove_cvref<decltype(values)>::type::value_type;
+              return pybind11::array_t<type>(std::size(values), std::data(values));
+            };
+            pybind11::dict result;
+            result["timestamp"] = helper(timestamp).attr("view")("datetime64[ns]");
+            result["source_port"] = helper(source_port);
+            result["destination_port"] = helper(destination_port);
+            result["offset"] = helper(offset);
+            result["length"] = helper(length);
+            return result;
+          },
+          pybind11::arg("ports") = std::vector<uint16_t>{},
+          "Extract all udp datagrams, returns {timestamp, source_port, destination_port, offset, length} (offset is "
+          "into data)");
+}
+
+}  // namespace python
+}  // namespace roq
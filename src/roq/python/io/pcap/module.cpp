@@ -0,0 +1,25 @@
+/* Copyright (c) 2017-2024, Hans Erik Thrane */
+
+#define PYBIND11_DETAILED_ERROR_MESSAGES
+
+#include "roq/python/io/pcap/module.hpp"
+
+#include "roq/python/utils.hpp"
+
+#include "roq/python/io/pcap/reader.hpp"
+
+using namespace std::literals;
+
+namespace roq {
+namespace python {
+namespace io {
+namespace pcap {
+
+void Module::create(pybind11::module_ &module) {
+  roq::python::utils::create_struct<roq::python::io::pcap::Reader>(module);
+}
+
+}  // namespace pcap
+}  // namespace io
+}  // namespace python
+}  // namespace roq
@@ -0,0 +1,19 @@
+/* Copyright (c) 2017-2024, Hans Erik Thrane */
+
+#pragma once
+
+#include <pybind11/pybind11.h>
+
+namespace roq {
+namespace python {
+namespace io {
+namespace pcap {
+
+struct Module final {
+  static void create(pybind11::module_ &);
+};
+
+}  // namespace pcap
+}  // namespace io
+}  // namespace python
+}  // namespace roq
@@ -0,0 +1,402 @@
+/* Copyright (c) 2017-2024, Hans Erik Thrane */
+
+#pragma once
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <bit>
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+namespace roq {
+namespace python {
+namespace io {
+namespace pcap {
+
+// note!
+//   reads udp datagrams from a pcap (micro- or nanosecond, either byte order) or pcapng capture file
+//   the file is memory mapped, i.e. payloads are views into the file (valid for the lifetime of the reader)
+//   link types: ethernet (incl. vlan), linux cooked (v1 and v2), raw ip and bsd loopback
+//   ip fragments, ipv6 extension headers and non-udp packets are skipped
+//   so are packets truncated by the capture (snaplen), i.e. a partial payload is never returned
+
+struct Reader final {
+  struct Packet final {
+    std::chrono::nanoseconds timestamp = {};  // capture time (since epoch)
+    uint16_t source_port = {};
+    uint16_t destination_port = {};
+    std::span<std::byte const> payload;  // udp payload
+  };
+
+  explicit Reader(std::string_view const &path) {
+    using namespace std::literals;
+    std::string path_2{path};
+    fd_ = ::open(path_2.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd_ < 0)
+      throw std::system_error{errno, std::generic_category(), "open"s};
+    struct stat stat = {};
+    if (::fstat(fd_, &stat) < 0) {
+      auto error = errno;
+      ::close(fd_);
+      throw std::system_error{error, std::generic_category(), "fstat"s};
+    }
+    size_ = static_cast<size_t>(stat.st_size);
+    if (size_) {
+      auto data = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd_, 0);
+      if (data == MAP_FAILED) {
+        auto error = errno;
+        ::close(fd_);
+        throw std::system_error{error, std::generic_category(), "mmap"s};
+      }
+      data_ = static_cast<std::byte const *>(data);
+      ::madvise(const_cast<std::byte *>(data_), size_, MADV_SEQUENTIAL);
+    }
+    if (size_ < 4) {
+      close();
+      throw std::invalid_argument{"Not a pcap file"s};
+    }
+  }
+
+  Reader(Reader const &) = delete;
+
+  ~Reader() { close(); }
+
+  std::span<std::byte const> data() const { return {data_, size_}; }
+
+  // note! packets not containing an udp datagram (after filtering)
+  size_t skipped() const { return skipped_; }
+
+  // note! callback(Packet const &), empty ports means all (destination) ports
+  template <typename Callback>
+  size_t dispatch(Callback callback, std::span<uint16_t const> const &ports = {}) {
+    skipped_ = {};
+    auto helper = [&](uint32_t link_type, std::chrono::nanoseconds timestamp, std::span<std::byte const> const &frame) {
+      Packet packet{
+          .timestamp = timestamp,
+          .source_port = {},
+          .destination_port = {},
+          .payload = {},
+      };
+      if (!parse_link(packet, link_type, frame) || !matches(packet, ports)) {
+        ++skipped_;
+        return false;
+      }
+      callback(packet);
+      return true;
+    };
+    auto magic = read<uint32_t>(data(), 0, false);
+    if (magic == PCAPNG_SECTION_HEADER)
+      return dispatch_pcapng(helper);
+    return dispatch_pcap(helper);
+  }
+
+ protected:
+  static constexpr uint32_t PCAP_MICROSECONDS = 0xA1B2C3D4;
+  static constexpr uint32_t PCAP_NANOSECONDS = 0xA1B23C4D;
+
+  static constexpr uint32_t PCAPNG_SECTION_HEADER = 0x0A0D0D0A;
+  static constexpr uint32_t PCAPNG_BYTE_ORDER = 0x1A2B3C4D;
+  static constexpr uint32_t PCAPNG_INTERFACE_DESCRIPTION = 1;
+  static constexpr uint32_t PCAPNG_PACKET = 2;  // obsolete
+  static constexpr uint32_t PCAPNG_SIMPLE_PACKET = 3;
+  static constexpr uint32_t PCAPNG_ENHANCED_PACKET = 6;
+  static constexpr uint16_t PCAPNG_IF_TSRESOL = 9;
+
+  static constexpr uint32_t LINKTYPE_NULL = 0;
+  static constexpr uint32_t LINKTYPE_ETHERNET = 1;
+  static constexpr uint32_t LINKTYPE_RAW = 101;
+  static constexpr uint32_t LINKTYPE_LINUX_SLL = 113;
+  static constexpr uint32_t LINKTYPE_IPV4 = 228;
+  static constexpr uint32_t LINKTYPE_IPV6 = 229;
+  static constexpr uint32_t LINKTYPE_LINUX_SLL2 = 276;
+
+  static constexpr uint16_t ETHERTYPE_IPV4 = 0x0800;
+  static constexpr uint16_t ETHERTYPE_IPV6 = 0x86DD;
+  static constexpr uint16_t ETHERTYPE_VLAN = 0x8100;
+  static constexpr uint16_t ETHERTYPE_QINQ = 0x88A8;
+
+  static constexpr uint8_t IPPROTO_UDP_ = 17;
+
+  // note! swap means file byte order differs from host byte order
+  template <typename T>
+  static T read(std::span<std::byte const> const &buffer, size_t offset, bool swap) {
+    T result;
+    std::memcpy(&result, std::data(buffer) + offset, sizeof(T));
+    return swap ? std::byteswap(result) : result;
+  }
+
+  template <typename T>
+  static T read_network(std::span<std::byte const> const &buffer, size_t offset) {
+    return read<T>(buffer, offset, std::endian::native == std::endian::little);
+  }
+
+  template <typename Helper>
+  size_t dispatch_pcap(Helper &helper) {
+    using namespace std::literals;
+    auto buffer = data();
+    if (std::size(buffer) < 24)
+      throw std::invalid_argument{"Not a pcap file"s};
+    auto magic = read<uint32_t>(buffer, 0, false);
+    bool swap = false, nanoseconds = false;
+    if (magic == PCAP_MICROSECONDS || magic == PCAP_NANOSECONDS) {
+      nanoseconds = magic == PCAP_NANOSECONDS;
+    } else if (std::byteswap(magic) == PCAP_MICROSECONDS || std::byteswap(magic) == PCAP_NANOSECONDS) {
+      swap = true;
+      nanoseconds = std::byteswap(magic) == PCAP_NANOSECONDS;
+    } else {
+      throw std::invalid_argument{"Not a pcap file"s};
+    }
+    // note! upper bits may contain the fcs length
+    auto link_type = read<uint32_t>(buffer, 20, swap) & 0x0FFFFFFF;
+    size_t result = {};
+    size_t offset = 24;
+    while ((offset + 16) <= std::size(buffer)) {
+      auto seconds = read<uint32_t>(buffer, offset, swap);
+      auto fraction = read<uint32_t>(buffer, offset + 4, swap);
+      auto length = read<uint32_t>(buffer, offset + 8, swap);
+      offset += 16;
+      if ((offset + length) > std::size(buffer))
+        break;  // note! truncated
+      auto timestamp = std::chrono::seconds{seconds} +
+                       (nanoseconds ? std::chrono::nanoseconds{fraction} : std::chrono::microseconds{fraction});
+      if (helper(link_type, timestamp, buffer.subspan(offset, length)))
+        ++result;
+      offset += length;
+    }
+    return result;
+  }
+
+  template <typename Helper>
+  size_t dispatch_pcapng(Helper &helper) {
+    struct Interface final {
+      uint32_t link_type = {};
+      uint8_t resolution = 6;  // note! if_tsresol (default is microseconds)
+    };
+    auto buffer = data();
+    std::vector<Interface> interfaces;
+    bool swap = false;
+    size_t result = {};
+    size_t offset = {};
+    while ((offset + 12) <= std::size(buffer)) {
+      auto type = read<uint32_t>(buffer, offset, false);
+      if (type == PCAPNG_SECTION_HEADER) {
+        auto byte_order = read<uint32_t>(buffer, offset + 8, false);
+        if (byte_order != PCAPNG_BYTE_ORDER && std::byteswap(byte_order) != PCAPNG_BYTE_ORDER)
+          break;
+        swap = byte_order != PCAPNG_BYTE_ORDER;
+        interfaces.clear();  // note! interfaces are scoped by section
+      } else {
+        type = read<uint32_t>(buffer, offset, swap);
+      }
+      auto length = read<uint32_t>(buffer, offset + 4, swap);
+      if (length < 12 || (offset + length) > std::size(buffer))
+        break;  // note! truncated
+      auto body = buffer.subspan(offset + 8, length - 12);
+      offset += length;
+      switch (type) {
+        case PCAPNG_INTERFACE_DESCRIPTION: {
+          if (std::size(body) < 8)
+            break;
+          Interface interface{.link_type = read<uint16_t>(body, 0, swap)};
+          for (size_t i = 8; (i + 4) <= std::size(body);) {
+            auto code = read<uint16_t>(body, i, swap);
+            auto length_2 = read<uint16_t>(body, i + 2, swap);
+            if (code == 0)
+              break;
+            if (code == PCAPNG_IF_TSRESOL && length_2 == 1 && (i + 5) <= std::size(body))
+              interface.resolution = static_cast<uint8_t>(body[i + 4]);
+            i += 4 + ((length_2 + 3) & ~3);
+          }
+          interfaces.emplace_back(interface);
+          break;
+        }
+        case PCAPNG_ENHANCED_PACKET:
+        case PCAPNG_PACKET: {
+          if (std::size(body) < 20)
+            break;
+          auto index = type == PCAPNG_PACKET ? read<uint16_t>(body, 0, swap) : read<uint32_t>(body, 0, swap);
+          auto high = read<uint32_t>(body, 4, swap);
+          auto low = read<uint32_t>(body, 8, swap);
+          auto length_2 = read<uint32_t>(body, 12, swap);
+          if (index >= std::size(interfaces) || (20 + length_2) > std::size(body))
+            break;
+          auto &interface = interfaces[index];
+          auto timestamp = to_nanoseconds((static_cast<uint64_t>(high) << 32) | low, interface.resolution);
+          if (helper(interface.link_type, timestamp, body.subspan(20, length_2)))
+            ++result;
+          break;
+        }
+        case PCAPNG_SIMPLE_PACKET: {
+          // note! no timestamp
+          if (std::size(body) < 4 || std::empty(interfaces))
+            break;
+          auto length_2 = std::min<size_t>(read<uint32_t>(body, 0, swap), std::size(body) - 4);
+          if (helper(interfaces[0].link_type, std::chrono::nanoseconds{}, body.subspan(4, length_2)))
+            ++result;
+          break;
+        }
+        default:
+          break;
+      }
+    }
+    return result;
+  }
+
+  // note! if_tsresol: msb clear means 10^-n, msb set means 2^-n
+  static std::chrono::nanoseconds to_nanoseconds(uint64_t value, uint8_t resolution) {
+    auto exponent = resolution & 0x7F;
+    if (resolution & 0x80) {
+      auto result = (static_cast<unsigned __int128>(value) * 1'000'000'000) >> exponent;
+      return std::chrono::nanoseconds{static_cast<int64_t>(result)};
+    }
+    int64_t result = static_cast<int64_t>(value);
+    for (auto i = exponent; i < 9; ++i)
+      result *= 10;
+    for (auto i = exponent; i > 9; --i)
+      result /= 10;
+    return std::chrono::nanoseconds{result};
+  }
+
+  static bool parse_link(Packet &packet, uint32_t link_type, std::span<std::byte const> const &frame) {
+    switch (link_type) {
+      case LINKTYPE_NULL: {
+        if (std::size(frame) < 4)
+          return false;
+        // note! host byte order of the capturing machine, the address family is small
+        auto family = read<uint32_t>(frame, 0, false);
+        if (family > 0xFFFF)
+          family = std::byteswap(family);
+        if (family == 2)
+          return parse_ipv4(packet, frame.subspan(4));
+        if (family == 24 || family == 28 || family == 30)
+          return parse_ipv6(packet, frame.subspan(4));
+        return false;
+      }
+      case LINKTYPE_ETHERNET: {
+        size_t offset = 12;
+        while ((offset + 2) <= std::size(frame)) {
+          auto ether_type = read_network<uint16_t>(frame, offset);
+          if (ether_type == ETHERTYPE_VLAN || ether_type == ETHERTYPE_QINQ) {
+            offset += 4;
+            continue;
+          }
+          return parse_ether_type(packet, ether_type, frame.subspan(offset + 2));
+        }
+        return false;
+      }
+      case LINKTYPE_LINUX_SLL:
+        if (std::size(frame) < 16)
+          return false;
+        return parse_ether_type(packet, read_network<uint16_t>(frame, 14), frame.subspan(16));
+      case LINKTYPE_LINUX_SLL2:
+        if (std::size(frame) < 20)
+          return false;
+        return parse_ether_type(packet, read_network<uint16_t>(frame, 0), frame.subspan(20));
+      case LINKTYPE_RAW:
+        if (std::empty(frame))
+          return false;
+        switch (static_cast<uint8_t>(frame[0]) >> 4) {
+          case 4:
+            return parse_ipv4(packet, frame);
+          case 6:
+            return parse_ipv6(packet, frame);
+        }
+        return false;
+      case LINKTYPE_IPV4:
+        return parse_ipv4(packet, frame);
+      case LINKTYPE_IPV6:
+        return parse_ipv6(packet, frame);
+    }
+    return false;
+  }
+
+  static bool parse_ether_type(Packet &packet, uint16_t ether_type, std::span<std::byte const> const &frame) {
+    switch (ether_type) {
+      case ETHERTYPE_IPV4:
+        return parse_ipv4(packet, frame);
+      case ETHERTYPE_IPV6:
+        return parse_ipv6(packet, frame);
+    }
+    return false;
+  }
+
+  static bool parse_ipv4(Packet &packet, std::span<std::byte const> const &frame) {
+    if (std::size(frame) < 20 || (static_cast<uint8_t>(frame[0]) >> 4) != 4)
+      return false;
+    size_t header_length = (static_cast<uint8_t>(frame[0]) & 0x0F) * 4;
+    size_t total_length = read_network<uint16_t>(frame, 2);
+    auto fragment = read_network<uint16_t>(frame, 6);
+    if ((fragment & 0x3FFF) != 0)  // note! more-fragments or fragment offset
+      return false;
+    if (static_cast<uint8_t>(frame[9]) != IPPROTO_UDP_ || header_length < 20 || total_length < header_length)
+      return false;
+    // note! the capture may include ethernet padding
+    if (total_length > std::size(frame))
+      return false;
+    return parse_udp(packet, frame.subspan(header_length, total_length - header_length));
+  }
+
+  static bool parse_ipv6(Packet &packet, std::span<std::byte const> const &frame) {
+    if (std::size(frame) < 40 || (static_cast<uint8_t>(frame[0]) >> 4) != 6)
+      return false;
+    if (static_cast<uint8_t>(frame[6]) != IPPROTO_UDP_)
+      return false;
+    size_t payload_length = read_network<uint16_t>(frame, 4);
+    if (payload_length > (std::size(frame) - 40))
+      return false;
+    return parse_udp(packet, frame.subspan(40, payload_length));
+  }
+
+  static bool parse_udp(Packet &packet, std::span<std::byte const> const &segment) {
+    if (std::size(segment) < 8)
+      return false;
+    packet.source_port = read_network<uint16_t>(segment, 0);
+    packet.destination_port = read_network<uint16_t>(segment, 2);
+    size_t length = read_network<uint16_t>(segment, 4);
+    if (length < 8 || length > std::size(segment))
+      return false;
+    packet.payload = segment.subspan(8, length - 8);
+    return true;
+  }
+
+  static bool matches(Packet const &packet, std::span<uint16_t const> const &ports) {
+    if (std::empty(ports))
+      return true;
+    for (auto port : ports)
+      if (port == packet.destination_port)
+        return true;
+    return false;
+  }
+
+  void close() {
+    if (data_ != nullptr)
+      ::munmap(const_cast<std::byte *>(data_), size_);
+    data_ = nullptr;
+    if (fd_ >= 0)
+      ::close(fd_);
+    fd_ = -1;
+  }
+
+ private:
+  int fd_ = -1;
+  std::byte const *data_ = nullptr;
+  size_t size_ = {};
+  size_t skipped_ = {};
+};
+
+}  // namespace pcap
+}  // namespace io
+}  // namespace python
+}  // namespace roq
@@ -14,79 +14,27 @@
 
 #include "roq/python/codec/udp/details.hpp"
 
+#include "roq/python/market/mbp/sequence.hpp"
+
 using namespace std::literals;
 
 namespace roq {
 namespace python {
 
 namespace {
-auto use_snapshot(auto &header, auto &sequencer) {
-  if (sequencer.ready()) {
-    return roq::codec::udp::is_incremental(header);
-  } else {
-    return true;  // note! we're happy with a snapshot from either of incremental or snapshot
-  }
-}
-
 void sequence_helper(auto &sequencer, auto &market_by_price_update, auto &header, auto &callback, auto &reset) {
-  auto create = [&](auto &bids, auto &asks, auto update_type) {
-    auto result = market_by_price_update;
-    result.bids = bids;
-    result.asks = asks;
-    result.update_type = update_type;
-    return result;
-  };
-  auto dispatch = [&](auto &mbp_update) {
+  auto publish = [&](auto &bids, auto &asks, auto update_type) {
+    auto mbp_update = market_by_price_update;
+    mbp_update.bids = bids;
+    mbp_update.asks = asks;
+    mbp_update.update_type = update_type;
     auto arg0 = pybind11::cast(utils::Ref{mbp_update});
     callback(arg0);
     if (arg0.ref_count() > 1) {
       throw std::runtime_error{"Objects must not be stored"s};
     }
   };
-  auto publish_update = [&](auto &bids, auto &asks) {
-    auto mbp_update = create(bids, asks, UpdateType::INCREMENTAL);
-    dispatch(mbp_update);
-  };
-  auto publish_snapshot = [&](auto &bids,
-                              auto &asks,
-                              [[maybe_unused]] auto sequence,
-                              [[maybe_unused]] auto retries,
-                              [[maybe_unused]] auto delay) {
-    auto mbp_update = create(bids, asks, UpdateType::SNAPSHOT);
-    dispatch(mbp_update);
-  };
-  auto request_snapshot = [&](auto retries) { reset(retries); };
-  switch (market_by_price_update.update_type) {
-    using enum UpdateType;
-    case UNDEFINED:
-      assert(false);
-      break;
-    case SNAPSHOT:
-      if (use_snapshot(header, sequencer)) {
-        sequencer(
-            market_by_price_update.bids,
-            market_by_price_update.asks,
-            header.last_sequence_number,
-            true,  // note! use the snapshot even when we don't have any incremental history
-            publish_snapshot,
-            request_snapshot);
-      }
-      break;
-    case INCREMENTAL:
-      sequencer(
-          market_by_price_update.bids,
-          market_by_price_update.asks,
-          header.sequence_number,
-          header.sequence_number,
-          header.last_sequence_number,
-          publish_update,
-          publish_snapshot,
-          request_snapshot);
-      break;
-    case STALE:
-      // (*market_by_price_).clear();
-      break;
-  }
+  market::mbp::sequence(sequencer, market_by_price_update, header, publish, reset);
 }
 }  // namespace
 
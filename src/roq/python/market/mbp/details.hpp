@@ -1,5 +1,7 @@
 /* Copyright (c) 2017-2024, Hans Erik Thrane */
 
+#pragma once
+
 #define PYBIND11_DETAILED_ERROR_MESSAGES
 
 #include "roq/cache/market_by_order.hpp"
@@ -0,0 +1,70 @@
+/* Copyright (c) 2017-2024, Hans Erik Thrane */
+
+#pragma once
+
+#include "roq/api.hpp"
+
+#include "roq/codec/udp/header.hpp"
+
+#include "roq/market/mbp/sequencer.hpp"
+
+namespace roq {
+namespace python {
+namespace market {
+namespace mbp {
+
+// note!
+//   applies a MarketByPriceUpdate (received from a udp feed) to the sequencer
+//   publish(bids, asks, update_type) is called with the sequenced update
+//   reset(retries) is called when the book is no longer valid (a snapshot is required)
+//   snapshots are accepted from either feed until the sequencer is ready, then only from the incremental feed
+
+template <typename Publish, typename Reset>
+void sequence(
+    roq::market::mbp::Sequencer &sequencer,
+    MarketByPriceUpdate const &market_by_price_update,
+    roq::codec::udp::Header const &header,
+    Publish const &publish,
+    Reset const &reset) {
+  auto publish_update = [&](auto &bids, auto &asks) { publish(bids, asks, UpdateType::INCREMENTAL); };
+  auto publish_snapshot = [&](auto &bids,
+                              auto &asks,
+                              [[maybe_unused]] auto sequence,
+                              [[maybe_unused]] auto retries,
+                              [[maybe_unused]] auto delay) { publish(bids, asks, UpdateType::SNAPSHOT); };
+  auto request_snapshot = [&](auto retries) { reset(retries); };
+  switch (market_by_price_update.update_type) {
+    using enum UpdateType;
+    case UNDEFINED:
+      break;
+    case SNAPSHOT:
+      if (!sequencer.ready() || roq::codec::udp::is_incremental(header)) {
+        sequencer(
+            market_by_price_update.bids,
+            market_by_price_update.asks,
+            header.last_sequence_number,
+            true,  // note! use the snapshot even when we don't have any incremental history
+            publish_snapshot,
+            request_snapshot);
+      }
+      break;
+    case INCREMENTAL:
+      sequencer(
+          market_by_price_update.bids,
+          market_by_price_update.asks,
+          header.sequence_number,
+          header.sequence_number,
+          header.last_sequence_number,
+          publish_update,
+          publish_snapshot,
+          request_snapshot);
+      break;
+    case STALE:
+      break;
+  }
+}
+
+}  // namespace mbp
+}  // namespace market
+}  // namespace python
+}  // namespace roq
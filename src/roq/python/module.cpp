@@ -9,7 +9,9 @@
 #include <pybind11/stl.h>
 
 #include "roq/python/details.hpp"
+#include "roq/python/histogram.hpp"
 #include "roq/python/utils.hpp"
+#include "roq/python/view.hpp"
 
 #include "roq/python/client/module.hpp"
 #include "roq/python/codec/module.hpp"
@@ -68,6 +70,13 @@ void Module::create(pybind11::module_ &module) {
   roq::python::utils::create_struct<roq::Trade>(module);
   roq::python::utils::create_struct<roq::UUID>(module);
 
+  // views
+
+  roq::python::utils::create_struct<roq::python::utils::View<roq::Fill>>(module);
+  roq::python::utils::create_struct<roq::python::utils::View<roq::MBPUpdate>>(module);
+  roq::python::utils::create_struct<roq::python::utils::View<roq::MBOUpdate>>(module);
+  roq::python::utils::create_struct<roq::python::utils::View<roq::Trade>>(module);
+
   // transport
 
   roq::python::utils::create_ref_struct<roq::MessageInfo>(module);
@@ -115,6 +124,10 @@ void Module::create(pybind11::module_ &module) {
 
   roq::python::utils::create_ref_struct<roq::CustomMetricsUpdate>(module);
 
+  // tools
+
+  roq::python::utils::create_struct<roq::python::Histogram>(module);
+
   // sub-modules
 
   auto logging = module.def_submodule("logging");
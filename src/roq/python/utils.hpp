@@ -6,6 +6,8 @@
 
 #include <nameof.hpp>
 
+#include <chrono>
+
 #include "roq/api.hpp"
 
 namespace roq {
@@ -27,6 +29,19 @@ auto to_int_flag(Mask<T> const &value) {
   return static_cast<T>(value.get());
 }
 
+// note! plain integer (nanoseconds since epoch or duration) avoiding the cost of datetime / timedelta
+template <typename T>
+int64_t to_nanoseconds(T const &value) {
+  if constexpr (std::is_same<T, std::chrono::year_month_day>::value) {
+    auto result = std::chrono::sys_days{value}.time_since_epoch();
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(result).count();
+  } else if constexpr (requires { value.to_duration(); }) {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(value.to_duration()).count();
+  } else {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(value).count();
+  }
+}
+
 template <typename T>
 void create_enum(auto &module) {
   std::string name{nameof::nameof_short_type<T>()};
@@ -0,0 +1,116 @@
+/* Copyright (c) 2017-2024, Hans Erik Thrane */
+
+#pragma once
+
+#include <pybind11/numpy.h>
+#include <pybind11/pybind11.h>
+
+#include <fmt/format.h>
+
+#include <iterator>
+#include <span>
+#include <stdexcept>
+#include <string>
+
+#include <nameof.hpp>
+
+namespace roq {
+namespace python {
+namespace utils {
+
+// note!
+//   read-only sequence over an underlying span (no copies until an item is accessed)
+//   indexing, slicing and iteration return copies
+//   the view keeps the owning object alive, so storing it will be caught by the ref-count check after the callback
+
+template <typename T>
+struct View final {
+  using value_type = T;
+
+  explicit View(std::span<T const> const &values) : values_{values} {}
+
+  size_t size() const { return std::size(values_); }
+
+  T const &at(pybind11::ssize_t index) const {
+    using namespace std::literals;
+    if (index < 0)
+      index += static_cast<pybind11::ssize_t>(std::size(values_));
+    if (index < 0 || static_cast<size_t>(index) >= std::size(values_))
+      throw pybind11::index_error{"Index out of range"s};
+    return values_[index];
+  }
+
+  std::span<T const> const &values() const { return values_; }
+
+ private:
+  std::span<T const> const values_;
+};
+
+// note! property getter returning a view (keeps the owner alive)
+template <typename Callback>
+auto create_view_getter(Callback const &callback) {
+  return pybind11::cpp_function(callback, pybind11::keep_alive<0, 1>());
+}
+
+// note! Buffer must be true only for types registered with PYBIND11_NUMPY_DTYPE
+template <typename T, bool Buffer = false>
+void create_view(pybind11::module_ &module) {
+  using value_type = View<T>;
+  std::string name{nameof::nameof_short_type<T>()};
+  name += "View";
+  auto result = [&]() {
+    if constexpr (Buffer) {
+      return pybind11::class_<value_type>(module, name.c_str(), pybind11::buffer_protocol());
+    } else {
+      return pybind11::class_<value_type>(module, name.c_str());
+    }
+  }();
+  result.def("__len__", [](value_type const &self) { return self.size(); })
+      .def("__getitem__", [](value_type const &self, pybind11::ssize_t index) { return T{self.at(index)}; })
+      // note! a slice returns a list of copies (same as the list api)
+      .def(
+          "__getitem__",
+          [](value_type const &self, pybind11::slice const &slice) {
+            pybind11::ssize_t start = {}, stop = {}, step = {}, length = {};
+            if (!slice.compute(static_cast<pybind11::ssize_t>(self.size()), &start, &stop, &step, &length))
+              throw pybind11::error_already_set{};
+            pybind11::list result;
+            for (pybind11::ssize_t i = 0; i < length; ++i)
+              result.append(T{self.values()[start + i * step]});
+            return result;
+          })
+      // note! items are copies
+      .def(
+          "__iter__",
+          [](value_type const &self) {
+            auto &values = self.values();
+            return pybind11::make_iterator<pybind11::return_value_policy::copy>(std::begin(values), std::end(values));
+          },
+          pybind11::keep_alive<0, 1>())
+      .def("__repr__", [](value_type const &self) {
+        using namespace std::literals;
+        std::string result;
+        for (auto &item : self.values()) {
+          if (!std::empty(result))
+            result += ", "sv;
+          fmt::format_to(std::back_inserter(result), "{}"sv, item);
+        }
+        return fmt::format("[{}]"sv, result);
+      });
+  if constexpr (Buffer) {
+    result.def_buffer([](value_type const &self) {
+      return pybind11::buffer_info(
+          const_cast<T *>(std::data(self.values())),
+          sizeof(T),
+          pybind11::format_descriptor<T>::format(),
+          1,
+          {static_cast<pybind11::ssize_t>(self.size())},
+          {static_cast<pybind11::ssize_t>(sizeof(T))},
+          true);
+    });
+  }
+}
+
+}  // namespace utils
+}  // namespace python
+}  // namespace roq